@@ -1,6 +1,108 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+/** Set to 1 to collect per-icon draw timings and cache counters (see FancyIconPack::Stats) */
+#ifndef FANCYICONPACK_ENABLE_STATS
+ #define FANCYICONPACK_ENABLE_STATS 0
+#endif
+
+/** Set to 0 to force the portable mask compositing kernel (see FancyIconPack::compositeMask) */
+#ifndef FANCYICONPACK_ENABLE_SIMD
+ #define FANCYICONPACK_ENABLE_SIMD 1
+#endif
+
+// ============================================================================
+// ICON LISTS
+// ============================================================================
+// X-macro lists of every icon, grouped by the source file that implements it.
+// Each entry expands to X(Name) for the matching drawName() function.
+
+#define FANCYICONPACK_GENERALUI_ICONS(X) \
+    X(Copy) X(Edit) X(Save) X(Load) X(NewPreset) X(Rename) X(Delete) X(Paste) X(Duplicate) X(Undo) \
+    X(Redo) X(Settings) X(BurgerMenu) X(Dropdown) X(Search) X(Close) X(Expand) X(Collapse) X(Info) \
+    X(Help) X(Warning) X(Error) X(Check) X(Plus) X(Minus) X(ArrowUp) X(ArrowDown) X(ArrowLeft) \
+    X(ArrowRight)
+
+#define FANCYICONPACK_GENERALUI_PART2_ICONS(X) \
+    X(ScrollHorizontal) X(ScrollVertical) X(Grid) X(List) X(Lock) X(Unlock) X(Bypass) X(Power) \
+    X(Refresh) X(Download) X(Upload) X(ExternalLink) X(Pin) X(DragHandle) X(ZoomIn) X(ZoomOut) \
+    X(Fullscreen) X(ExitFullscreen) X(Tab) X(SliderHorizontal) X(SliderVertical) X(Knob) X(Switch) \
+    X(ToggleOn) X(ToggleOff) X(Checkbox) X(RadioOn) X(RadioOff) X(ContextMenu)
+
+#define FANCYICONPACK_AUDIO_PART1_ICONS(X) \
+    X(Volume) X(Gain) X(Pan) X(Mute) X(Solo) X(Meter) X(Peak) X(Clip) X(Waveform) X(Spectrum) \
+    X(SineWave) X(SquareWave) X(TriangleWave) X(SawWave) X(Noise) X(Phase) X(InvertPhase) \
+    X(Frequency) X(Resonance) X(Bandwidth) X(EQ) X(Filter) X(Lowpass) X(Highpass) X(Bandpass)
+
+#define FANCYICONPACK_AUDIO_PART2_ICONS(X) \
+    X(Notch) X(CombFilter) X(Formant) X(Envelope) X(ADSR) X(AR) X(Hold) X(LFO) X(Sync) X(Input) \
+    X(Output) X(Mix) X(DryWet) X(Feedback) X(Routing) X(SignalPath) X(PatchCable) X(Crossfade) \
+    X(Sidechain) X(Compressor) X(Limiter) X(Expander) X(Saturator) X(Distortion) X(Bitcrusher) \
+    X(Waveshaper) X(Reverb) X(Delay) X(PingPongDelay) X(Chorus) X(Flanger) X(Phaser) X(Granular) \
+    X(Freeze) X(Stereo) X(Mono) X(Width) X(Balance)
+
+#define FANCYICONPACK_MIDI_PART1_ICONS(X) \
+    X(Midi) X(MidiIn) X(MidiOut) X(MidiChannel) X(MidiCC) X(MidiLearn) X(Note) X(Velocity) \
+    X(Aftertouch) X(PolyAftertouch) X(ModWheel) X(PitchBend) X(Keytrack) X(EnvelopeFollow) X(Macro) \
+    X(MacroAssign)
+
+#define FANCYICONPACK_MIDI_PART2_ICONS(X) \
+    X(ModMatrix) X(ModSource) X(ModDestination) X(ModDepth) X(ModAmount) X(ModCurve) X(ModShape) \
+    X(ModRouting) X(ModSignal) X(Automation) X(AutomationLane) X(AutomationCurve) X(CV) X(CVIn) \
+    X(CVOut)
+
+#define FANCYICONPACK_SYNTH_PART1_ICONS(X) \
+    X(Osc) X(Osc1) X(Osc2) X(Osc3) X(SubOsc) X(NoiseOsc) X(Unison) X(Voices) X(Polyphony) X(Filter1) \
+    X(Filter2) X(Amp) X(VCA)
+
+#define FANCYICONPACK_SYNTH_PART2_ICONS(X) \
+    X(Env1) X(Env2) X(LFO1) X(LFO2) X(LFO3) X(FX) X(FXChain) X(FXSlot) X(TransientShaper) \
+    X(PitchShifter) X(Lofi) X(StereoImager) X(Utility) X(Analyzer) X(Tuner)
+
+#define FANCYICONPACK_ADVANCED_PART1_ICONS(X) \
+    X(GroupParameters) X(LinkControls) X(AssignModulator) X(LearnMode) X(VisualModulation) \
+    X(AnimatedKnob) X(SpectrumDisplay) X(WaveformDisplay) X(EnvelopeDisplay) X(GridSnapping) \
+    X(ResizablePanel) X(FloatingPanel) X(Overlay) X(Tooltip)
+
+#define FANCYICONPACK_ADVANCED_PART2_ICONS(X) \
+    X(ContextPopup) X(ThemeLight) X(ThemeDark) X(ColorPicker) X(PresetBrowser) X(PresetFavorite) \
+    X(PresetRandom) X(InitPreset) X(SavePreset) X(LockParameter) X(ParameterAutomation) \
+    X(DragToAssign) X(DragToConnect)
+
+#define FANCYICONPACK_ICON_LIST(X) \
+    FANCYICONPACK_GENERALUI_ICONS(X) \
+    FANCYICONPACK_GENERALUI_PART2_ICONS(X) \
+    FANCYICONPACK_AUDIO_PART1_ICONS(X) \
+    FANCYICONPACK_AUDIO_PART2_ICONS(X) \
+    FANCYICONPACK_MIDI_PART1_ICONS(X) \
+    FANCYICONPACK_MIDI_PART2_ICONS(X) \
+    FANCYICONPACK_SYNTH_PART1_ICONS(X) \
+    FANCYICONPACK_SYNTH_PART2_ICONS(X) \
+    FANCYICONPACK_ADVANCED_PART1_ICONS(X) \
+    FANCYICONPACK_ADVANCED_PART2_ICONS(X)
+
+/**
+ * The icons compiled into the IconId dispatch table. Define this project-wide
+ * (it must match in every translation unit) to ship only a subset, e.g.
+ *
+ *   #define FANCYICONPACK_SELECTED_ICONS(X) FANCYICONPACK_GENERALUI_ICONS(X) X(Knob) X(Meter)
+ *
+ * Every IconId stays declared, so ids, names and baked data are unaffected.
+ * Unselected ids dispatch to nothing, which leaves their draw* functions
+ * unreferenced for the linker to drop.
+ */
+#ifndef FANCYICONPACK_SELECTED_ICONS
+ #define FANCYICONPACK_SELECTED_ICONS(X) FANCYICONPACK_ICON_LIST(X)
+#endif
 
 /**
  * FancyIconPack - An advanced icon drawing utility for modern audio plugin UIs
@@ -232,8 +334,11 @@ public:
 
     // Control Types
     static void drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
     static void drawSliderVertical(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawSliderVertical(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
     static void drawKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
     static void drawSwitch(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawToggleOn(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawToggleOff(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
@@ -320,6 +425,7 @@ public:
     static void drawPhaser(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawGranular(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float phase);
 
     // Stereo and Spatial
     static void drawStereo(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
@@ -358,7 +464,9 @@ public:
     static void drawModSource(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawModDestination(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawModDepth(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawModDepth(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
     static void drawModAmount(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawModAmount(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
     static void drawModCurve(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawModShape(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawModRouting(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
@@ -415,6 +523,7 @@ public:
     static void drawUtility(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawAnalyzer(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
 
     // ============================================================================
     // ADVANCED UI / WORKFLOW FEATURES
@@ -426,7 +535,9 @@ public:
     static void drawAssignModulator(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawLearnMode(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawVisualModulation(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawVisualModulation(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float phase);
     static void drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float phase);
 
     // Display Components
     static void drawSpectrumDisplay(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
@@ -458,4 +569,2458 @@ public:
     // Interaction Features
     static void drawDragToAssign(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
     static void drawDragToConnect(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+
+    // ============================================================================
+    // ICON REGISTRY
+    // ============================================================================
+
+    /** Identifies every icon in the pack, in declaration order */
+    enum class IconId : juce::uint16
+    {
+       #define FANCYICONPACK_DECLARE_ICON_ID(name) name,
+        FANCYICONPACK_ICON_LIST(FANCYICONPACK_DECLARE_ICON_ID)
+       #undef FANCYICONPACK_DECLARE_ICON_ID
+    };
+
+   #define FANCYICONPACK_COUNT_ICON(name) + 1
+    /** Total number of icons in the pack */
+    static constexpr int numIcons = 0 FANCYICONPACK_ICON_LIST(FANCYICONPACK_COUNT_ICON);
+
+    /** Number of icons in FANCYICONPACK_SELECTED_ICONS, which sizes the dispatch table */
+    static constexpr int numSelectedIcons = 0 FANCYICONPACK_SELECTED_ICONS(FANCYICONPACK_COUNT_ICON);
+   #undef FANCYICONPACK_COUNT_ICON
+
+    /** Signature shared by every draw* function */
+    using DrawFunction = void (*)(juce::Graphics&, juce::Rectangle<float>, juce::Colour);
+
+    /**
+     * Look up the draw function for an icon
+     * @param icon Icon identifier
+     * @return The matching draw* function, or nullptr if the icon isn't selected
+     */
+    static DrawFunction getDrawFunction(IconId icon) noexcept;
+
+    /**
+     * Check whether an icon was compiled into the dispatch table
+     * @param icon Icon identifier
+     * @return True if the icon is listed in FANCYICONPACK_SELECTED_ICONS
+     */
+    static bool isIconSelected(IconId icon) noexcept;
+
+    /**
+     * Get the name of an icon, matching its draw* function without the prefix
+     * @param icon Icon identifier
+     * @return Icon name, e.g. "SawWave"
+     */
+    static const char* getIconName(IconId icon) noexcept;
+
+    /**
+     * Draw any icon through its identifier; unselected icons draw nothing
+     * @param g Graphics context
+     * @param icon Icon to draw
+     * @param bounds Icon bounds
+     * @param color Icon color
+     */
+    static void drawIcon(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color);
+
+    // ============================================================================
+    // GEOMETRY RECORDING
+    // ============================================================================
+
+    /**
+     * The output of one draw* call, captured as the fills it sent to the renderer.
+     * Strokes, lines and outlined shapes arrive here already expanded into outline
+     * paths, so replaying a recording only ever fills.
+     */
+    struct IconGeometry
+    {
+        /** A single recorded fill: an outline path, a rectangle or one glyph of text */
+        struct Op
+        {
+            enum class Type { path, rectangle, glyph };
+
+            Type type = Type::path;
+            juce::FillType fill;
+            juce::Path path;
+            juce::Rectangle<float> rectangle;
+
+            /**
+             * True if the op outlines a shape rather than filling it: the stroker's
+             * output, a drawLine() segment or a drawRect() edge
+             */
+            bool isStroke = false;
+
+            // Glyph ops are replayed through the renderer's own glyph cache so
+            // text stays identical to a live draw (hinting included)
+            int glyph = 0;
+            juce::Font font;
+            juce::AffineTransform glyphTransform;
+        };
+
+        juce::Array<Op> ops;
+        juce::Rectangle<float> bounds;
+
+        /** False if the icon used clipping, images or layers that can't be replayed */
+        bool isComplete = true;
+
+        /** Number of fill, font, opacity, transform and save/restore changes made while drawing */
+        int numStateChanges = 0;
+
+        /**
+         * Replay the recording
+         * @param g Graphics context
+         * @param origin Top-left corner to draw at; the recording is translated there
+         */
+        void draw(juce::Graphics& g, juce::Point<float> origin) const;
+
+        /** Approximate heap footprint of the recorded paths */
+        size_t getMemoryUsage() const noexcept;
+    };
+
+    /**
+     * Run an icon's draw function against a recording context
+     * @param icon Icon to record
+     * @param bounds Bounds to record at; geometry depends on size through getOptimalStrokeWidth
+     * @param color Icon color
+     * @param physicalPixelScale Display scale the geometry is destined for (affects curve flattening)
+     * @return The recorded geometry
+     */
+    static IconGeometry recordIcon(IconId icon, juce::Rectangle<float> bounds, juce::Colour color,
+                                   float physicalPixelScale = 1.0f);
+
+    /**
+     * Record any function with the draw* signature, e.g. a static layer that isn't an icon itself
+     * @param draw Function to record
+     * @param bounds Bounds to record at
+     * @param color Color passed to the function
+     * @param physicalPixelScale Display scale the geometry is destined for
+     * @return The recorded geometry
+     */
+    static IconGeometry recordDrawing(DrawFunction draw, juce::Rectangle<float> bounds, juce::Colour color,
+                                      float physicalPixelScale = 1.0f);
+
+    // ============================================================================
+    // COMPLEXITY ANALYSIS
+    // ============================================================================
+
+    /**
+     * Rendering cost of one icon, measured on its recorded geometry, i.e. after
+     * stroke expansion, as the rasteriser sees it. Also used as a budget, where a
+     * negative field means "no limit".
+     */
+    struct Complexity
+    {
+        int subPaths = 0;
+        int lineSegments = 0;
+        int curveSegments = 0;
+        int strokeOps = 0;      // outlines: strokePath, drawEllipse, drawRoundedRectangle, drawLine, drawRect...
+        int fillOps = 0;        // plain fills
+        int textOps = 0;        // glyphs drawn
+        int stateChanges = 0;
+
+        /** Budget with every limit disabled */
+        static Complexity unlimited() noexcept;
+
+        /**
+         * List the fields where this measurement is over a budget
+         * @param budget Limits to compare against; negative fields are ignored
+         * @return Human-readable descriptions, empty if within budget
+         */
+        juce::StringArray getViolations(const Complexity& budget) const;
+    };
+
+    /**
+     * Measure an icon's rendering cost
+     * @param icon Icon to analyse
+     * @param size Square size to record at (default: 48)
+     * @return Segment and op counts for the icon at that size
+     */
+    static Complexity analyseIcon(IconId icon, float size = 48.0f);
+
+    /**
+     * Build a table of every icon's complexity, most expensive first
+     * @param size Square size to record at (default: 48)
+     * @return Plain-text report, one icon per line
+     */
+    static juce::String createComplexityReport(float size = 48.0f);
+
+    /**
+     * Check every icon against a budget specification, for use in CI.
+     *
+     * The spec is plain text, one rule per line:
+     * @code
+     * # '*' sets the default for all icons, later lines override single fields
+     * *              subPaths=40 lineSegments=400 curveSegments=200
+     * PingPongDelay  subPaths=64
+     * @endcode
+     * Field names match the members of Complexity, and limits are whole numbers;
+     * -1 lifts a limit, e.g. to exempt one icon from the default. Unknown icons,
+     * fields or malformed limits are reported as errors so a typo can't silently
+     * disable a budget.
+     *
+     * @param budgetSpec Budget rules
+     * @param size Square size to record at (default: 48)
+     * @return One line per violation or spec error, empty if everything is within budget
+     */
+    static juce::StringArray checkComplexityBudgets(const juce::String& budgetSpec, float size = 48.0f);
+
+    // ============================================================================
+    // GEOMETRY CACHE
+    // ============================================================================
+
+    /**
+     * Keeps recorded icon geometry so repeated draws skip the draw* code and the
+     * stroker entirely: every stroke, line and outline is expanded once, with the
+     * caps and joins the icon chose, and each redraw is a sequence of fills.
+     *
+     * Entries are keyed by exact size rather than by stroke width bucket, since
+     * getOptimalStrokeWidth returns absolute widths and an outline expanded at one
+     * size would have the wrong weight if scaled to another size in the same bucket.
+     * The key also includes the display scale and the color, so replayed output
+     * matches a live draw. Least recently used entries are evicted once the cache
+     * grows past its memory budget.
+     */
+    class GeometryCache
+    {
+    public:
+        /**
+         * Create an empty cache
+         * @param maxBytes Memory budget for recorded paths (default: 4 MB)
+         */
+        explicit GeometryCache(size_t maxBytes = 4 * 1024 * 1024);
+        ~GeometryCache();
+
+        /** The cache used by drawCached() */
+        static GeometryCache& getInstance();
+
+        /**
+         * Draw an icon from cached geometry, recording it on first use
+         * @param g Graphics context
+         * @param icon Icon to draw
+         * @param bounds Icon bounds
+         * @param color Icon color
+         */
+        void draw(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color);
+
+        /**
+         * Fetch (recording if needed) the geometry for an icon at the origin
+         * @param icon Icon identifier
+         * @param size Icon width and height
+         * @param color Icon color
+         * @param physicalPixelScale Display scale the geometry will be drawn at
+         * @return Shared geometry, positioned at (0, 0)
+         */
+        std::shared_ptr<const IconGeometry> getGeometry(IconId icon, juce::Point<float> size, juce::Colour color,
+                                                        float physicalPixelScale = 1.0f);
+
+        /**
+         * Fetch (recording if needed) the geometry for any function with the draw* signature
+         * @param draw Function to record; it must draw the same thing every time for the same arguments
+         * @param size Drawing width and height
+         * @param color Color passed to the function
+         * @param physicalPixelScale Display scale the geometry will be drawn at
+         * @return Shared geometry, positioned at (0, 0)
+         */
+        std::shared_ptr<const IconGeometry> getGeometry(DrawFunction draw, juce::Point<float> size, juce::Colour color,
+                                                        float physicalPixelScale = 1.0f);
+
+        /** Drop every entry */
+        void clear();
+
+        /** Change the memory budget, evicting entries if needed */
+        void setMaxBytes(size_t newMaxBytes);
+
+        /** Bytes currently held by cached geometry */
+        size_t getBytesResident() const;
+
+    private:
+        struct Key
+        {
+            DrawFunction draw;
+            int width, height, scale;
+            juce::uint32 argb;
+
+            bool operator==(const Key& other) const noexcept
+            {
+                return draw == other.draw && width == other.width && height == other.height
+                    && scale == other.scale && argb == other.argb;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const noexcept;
+        };
+
+        struct Entry
+        {
+            std::shared_ptr<const IconGeometry> geometry;
+            std::list<Key>::iterator position;
+            size_t bytes = 0;
+        };
+
+        void evictIfNeeded();
+
+        juce::CriticalSection lock;
+        std::list<Key> recency;
+        std::unordered_map<Key, Entry, KeyHash> entries;
+        size_t maxBytes, bytesResident = 0;
+
+        JUCE_DECLARE_NON_COPYABLE(GeometryCache)
+    };
+
+    /**
+     * Draw an icon through the shared GeometryCache
+     * @param g Graphics context
+     * @param icon Icon to draw
+     * @param bounds Icon bounds
+     * @param color Icon color
+     */
+    static void drawCached(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color);
+
+    // ============================================================================
+    // BAKED ICON DATA
+    // ============================================================================
+
+    /**
+     * A compact binary snapshot of the pack's geometry, produced once by bake()
+     * and drawn by a small interpreter.
+     *
+     * Each icon is recorded at a fixed set of square sizes and stored as quantised
+     * 16-bit coordinates (1/8192 of the icon size), path op codes and per-op color
+     * roles. Because stroke widths are chosen per size by getOptimalStrokeWidth,
+     * an entry is exact only at the size and physical pixel scale it was baked at;
+     * other sizes and scales fall back to the live draw function.
+     *
+     * The set never copies its data, so it can be constructed directly on a
+     * BinaryData resource.
+     *
+     * Baking alone doesn't shrink the binary: the fallback keeps every selected
+     * draw* function linked. To drop them, bake in a full build, then ship with
+     * FANCYICONPACK_SELECTED_ICONS set to createLiveIconSelection() and draw only
+     * at the baked sizes and scale; anything else then draws nothing.
+     */
+    class BakedIconSet
+    {
+    public:
+        /**
+         * Wrap baked data without copying it
+         * @param data Start of the blob; must outlive this object
+         * @param dataSize Size of the blob in bytes
+         */
+        BakedIconSet(const void* data, size_t dataSize) noexcept;
+
+        /** True if the blob header matches this build of the pack */
+        bool isValid() const noexcept { return valid; }
+
+        /**
+         * Check whether an icon was baked at a given size
+         * @param icon Icon identifier
+         * @param size Square icon size in pixels
+         */
+        bool contains(IconId icon, float size) const noexcept;
+
+        /**
+         * Draw an icon from baked data, falling back to the live draw function when
+         * the bounds or display scale don't match the bake, the icon's colors can't
+         * be rebased, or its text was stored as approximate outlines
+         * @param g Graphics context
+         * @param icon Icon to draw
+         * @param bounds Icon bounds
+         * @param color Icon color
+         */
+        void draw(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+        /**
+         * List the icons this set can't draw by itself at every baked size: ones
+         * that weren't baked, and ones whose derived tones or text take the live path
+         * @return One "X(Name)" per icon, ready for FANCYICONPACK_SELECTED_ICONS
+         */
+        juce::String createLiveIconSelection() const;
+
+        /**
+         * Record every icon at the given sizes and serialise the result
+         * @param sizes Square sizes to bake, in pixels (default: one per stroke width bucket)
+         * @param physicalPixelScale Display scale to record for; draws on other scales use the live path
+         * @return The baked blob, ready to be written out and embedded as BinaryData
+         */
+        static juce::MemoryBlock bake(const juce::Array<float>& sizes = { 24.0f, 48.0f, 96.0f },
+                                      float physicalPixelScale = 1.0f);
+
+    private:
+        const juce::uint8* findEntry(IconId icon, float size) const noexcept;
+        void drawEntry(juce::Graphics& g, const juce::uint8* entry, juce::Rectangle<float> bounds,
+                       juce::Colour color) const;
+
+        const juce::uint8* data = nullptr;
+        size_t dataSize = 0;
+        int numSizes = 0;
+        float bakedScale = 1.0f;
+        bool valid = false;
+    };
+
+    // ============================================================================
+    // GOLDEN IMAGE VERIFICATION
+    // ============================================================================
+
+    /**
+     * Renders icons to images and compares them against reference PNGs, so the
+     * cached and baked rendering paths can be checked against the plain draw*
+     * output. Meant to be driven from a test runner or CI step.
+     */
+    class GoldenImages
+    {
+    public:
+        GoldenImages() = delete;
+
+        /** How an icon is rendered */
+        enum class RenderMode
+        {
+            live,       // draw* function
+            cached,     // GeometryCache replay
+            baked       // BakedIconSet interpreter
+        };
+
+        /** Component states rendered through getStateColor() */
+        enum class State { normal, highlighted, pressed, disabled };
+
+        /** Which variants to render and how strictly to compare them */
+        struct Settings
+        {
+            juce::Array<float> sizes { 16.0f, 24.0f, 32.0f, 48.0f, 64.0f, 128.0f };
+            juce::Array<float> scales { 1.0f, 2.0f };
+            juce::Array<State> states { State::normal, State::highlighted, State::pressed, State::disabled };
+            juce::Colour baseColor { 0xff888888 };
+
+            /** Largest allowed per-channel difference (0-255) before a pixel counts as changed */
+            int tolerance = 0;
+
+            /** Number of changed pixels allowed per image */
+            int maxMismatchedPixels = 0;
+        };
+
+        /** Outcome of comparing two images */
+        struct Comparison
+        {
+            int maxDifference = 0;
+            int mismatchedPixels = 0;
+            bool sizeMismatch = false;
+            juce::Image diff;   // mismatches in red over a faded copy of the reference
+
+            bool passes(const Settings& settings) const noexcept
+            {
+                return ! sizeMismatch && mismatchedPixels <= settings.maxMismatchedPixels;
+            }
+        };
+
+        /**
+         * Render one icon variant into a new ARGB image
+         * @param icon Icon to render
+         * @param size Logical icon size
+         * @param scale Display scale; the image is size * scale pixels square
+         * @param color Icon color
+         * @param mode Rendering path to use
+         * @param baked Baked data, required for RenderMode::baked
+         */
+        static juce::Image render(IconId icon, float size, float scale, juce::Colour color,
+                                  RenderMode mode = RenderMode::live, const BakedIconSet* baked = nullptr);
+
+        /**
+         * Compare two images pixel by pixel
+         * @param expected Reference image
+         * @param actual Image under test
+         * @param tolerance Largest per-channel difference that still counts as equal
+         */
+        static Comparison compare(const juce::Image& expected, const juce::Image& actual, int tolerance);
+
+        /** File name used for a variant, e.g. "Settings_48px@2x_normal.png" */
+        static juce::String getFileName(IconId icon, float size, float scale, State state);
+
+        /**
+         * Render every icon variant with the live draw functions and write them as PNGs
+         * @param directory Target directory, created if needed
+         * @param settings Variants to render
+         * @return Number of images written
+         */
+        static int writeReferences(const juce::File& directory, const Settings& settings);
+
+        /**
+         * Render every variant and compare it with the reference PNGs in a directory.
+         * For each failure a "<name>.diff.png" is written next to the references.
+         * @param directory Directory holding the references
+         * @param settings Variants and tolerances
+         * @param mode Rendering path under test
+         * @param baked Baked data, required for RenderMode::baked
+         * @return One line per failing or missing image, empty if everything matches
+         */
+        static juce::StringArray verify(const juce::File& directory, const Settings& settings,
+                                        RenderMode mode = RenderMode::cached, const BakedIconSet* baked = nullptr);
+
+        /**
+         * Compare a rendering path against the live draw functions directly, without references
+         * @param settings Variants and tolerances
+         * @param mode Rendering path under test
+         * @param baked Baked data, required for RenderMode::baked
+         * @return One line per failing variant
+         */
+        static juce::StringArray compareWithLive(const Settings& settings, RenderMode mode,
+                                                 const BakedIconSet* baked = nullptr);
+    };
+
+    // ============================================================================
+    // STATISTICS
+    // ============================================================================
+
+    /**
+     * Per-icon draw timings and geometry cache counters, collected in real sessions.
+     * Collection only exists when FANCYICONPACK_ENABLE_STATS is 1. Otherwise every
+     * hook is an empty inline function and snapshots come back zeroed.
+     */
+    class Stats
+    {
+    public:
+        Stats() = delete;
+
+        /** Whether collection is compiled in */
+        static constexpr bool isEnabled = FANCYICONPACK_ENABLE_STATS != 0;
+
+        /** Entry point a draw went through */
+        enum class DrawPath : juce::uint8 { live, cached, baked };
+
+        /** Accumulated timing for one icon */
+        struct IconTiming
+        {
+            juce::uint64 calls = 0;
+            double totalMs = 0.0;
+            double maxMs = 0.0;
+        };
+
+        /** Counters summed over every GeometryCache */
+        struct CacheCounters
+        {
+            juce::uint64 hits = 0;
+            juce::uint64 misses = 0;
+            juce::uint64 evictions = 0;
+            size_t bytesResident = 0;
+        };
+
+        /** A copy of every counter at one point in time */
+        struct Snapshot
+        {
+            juce::Array<IconTiming> icons;  // indexed by IconId, empty when stats are disabled
+            CacheCounters geometryCache;
+
+            /** Icons that were drawn at least once, with their timings and the cache counters */
+            juce::String toJSON() const;
+        };
+
+        /** Take a snapshot of the current counters */
+        static Snapshot getSnapshot();
+
+        /**
+         * Format the most recent draws as Chrome trace events (chrome://tracing, Perfetto)
+         * @return JSON trace, with one complete event per draw and cache counter events
+         */
+        static juce::String createChromeTrace();
+
+        /** Zero every counter and drop recorded trace events. Bytes resident are kept. */
+        static void reset();
+
+        /**
+         * Times one draw. Draws nested inside another (cache misses recording the
+         * icon, fallbacks to the live draw) are counted as part of the outer one.
+         */
+        class ScopedDrawTimer
+        {
+        public:
+           #if FANCYICONPACK_ENABLE_STATS
+            ScopedDrawTimer(IconId icon, DrawPath path) noexcept;
+            ~ScopedDrawTimer();
+
+        private:
+            IconId icon;
+            DrawPath path;
+            juce::int64 startTicks = 0;
+            bool isOutermost;
+           #else
+            ScopedDrawTimer(IconId, DrawPath) noexcept {}
+           #endif
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedDrawTimer)
+        };
+
+       #if FANCYICONPACK_ENABLE_STATS
+        static void cacheHit() noexcept;
+        static void cacheMiss(size_t bytesAdded) noexcept;
+        static void cacheEvicted(size_t bytesRemoved) noexcept;
+        static void cacheReleased(size_t bytesRemoved) noexcept;
+       #else
+        static void cacheHit() noexcept {}
+        static void cacheMiss(size_t) noexcept {}
+        static void cacheEvicted(size_t) noexcept {}
+        static void cacheReleased(size_t) noexcept {}
+       #endif
+    };
+
+    // ============================================================================
+    // LIVE METER
+    // ============================================================================
+
+    /** Number of level bars in drawMeter() and LiveMeter */
+    static constexpr int numMeterBars = 5;
+
+    /**
+     * Bounds of one of drawMeter's bars
+     * @param bounds Meter bounds
+     * @param index Bar index, 0 (quietest) to numMeterBars - 1 (loudest)
+     */
+    static juce::Rectangle<float> getMeterBarBounds(juce::Rectangle<float> bounds, int index);
+
+    /** Color of one of drawMeter's bars: base color, then yellow, then red */
+    static juce::Colour getMeterBarColor(juce::Colour color, int index);
+
+    /** The static part of a live meter: background, outline and unlit bar slots */
+    static void drawMeterFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+
+    /**
+     * Wait-free single-producer, single-consumer queue of meter levels.
+     * The audio thread pushes one peak/RMS pair per block and the message
+     * thread drains everything that arrived since its last tick.
+     */
+    class MeterLevelQueue
+    {
+    public:
+        /** @param capacity Number of blocks that can be queued between two message thread ticks */
+        explicit MeterLevelQueue(int capacity = 512);
+
+        /**
+         * Queue the levels of one audio block. Never blocks or allocates.
+         * @param peak Linear peak level
+         * @param rms Linear RMS level
+         * @return False if the queue was full and the block was dropped
+         */
+        bool push(float peak, float rms) noexcept;
+
+        /**
+         * Drain every queued block
+         * @param peak Receives the highest queued peak
+         * @param rms Receives the highest queued RMS
+         * @return False if nothing was queued
+         */
+        bool popAll(float& peak, float& rms) noexcept;
+
+    private:
+        struct Levels
+        {
+            float peak, rms;
+        };
+
+        juce::AbstractFifo fifo;
+        juce::HeapBlock<Levels> buffer;
+
+        JUCE_DECLARE_NON_COPYABLE(MeterLevelQueue)
+    };
+
+    /**
+     * Message thread state of a value-driven meter. Each bar lights up when
+     * the displayed RMS reaches its threshold and half lights for the peak.
+     * The held peak is shown as an outlined bar. update() applies peak-hold
+     * and decay ballistics and reports which bars changed, so callers can
+     * repaint just those bars. The frame comes from the shared GeometryCache,
+     * so meters of the same size and color share one recording.
+     */
+    class LiveMeter
+    {
+    public:
+        /** Meter response */
+        struct Ballistics
+        {
+            float decayDbPerSecond = 24.0f;
+            float peakHoldSeconds = 1.5f;
+
+            /** Level each bar lights up at, quietest first */
+            float thresholdsDb[numMeterBars] { -42.0f, -30.0f, -18.0f, -9.0f, -3.0f };
+        };
+
+        LiveMeter() = default;
+        explicit LiveMeter(const Ballistics& ballistics);
+
+        /**
+         * Consume new levels and advance the ballistics
+         * @param queue Queue fed by the audio thread
+         * @param elapsedSeconds Time since the previous update
+         * @return Bit i is set if bar i needs repainting
+         */
+        juce::uint32 update(MeterLevelQueue& queue, float elapsedSeconds);
+
+        /**
+         * Area covering the changed bars, for Component::repaint()
+         * @param bounds Meter bounds
+         * @param changedBars Mask returned by update()
+         */
+        static juce::RectangleList<int> getDirtyRegion(juce::Rectangle<float> bounds, juce::uint32 changedBars);
+
+        /**
+         * Draw the meter; bars outside the current clip region are skipped
+         * @param g Graphics context
+         * @param bounds Meter bounds
+         * @param color Base color
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+        /** Drop all levels and held peaks */
+        void reset();
+
+    private:
+        enum class BarState : juce::uint8 { off, held, peak, rms };
+
+        BarState getBarState(int index) const noexcept;
+
+        Ballistics ballistics;
+        float peakDb = minimumDb, rmsDb = minimumDb, heldDb = minimumDb;
+        float holdRemaining = 0.0f;
+        BarState barStates[numMeterBars] {};
+
+        static constexpr float minimumDb = -100.0f;
+    };
+
+    // ============================================================================
+    // PARAMETRIC ENVELOPES
+    // ============================================================================
+
+    /** Envelope values to show in the parametric envelope icons */
+    struct EnvelopeShape
+    {
+        /** Stage times in seconds. Widths follow the square root of time so short attacks stay visible. */
+        float attack = 0.01f, decay = 0.2f, release = 0.3f;
+
+        /** Sustain level, 0 to 1 */
+        float sustain = 0.65f;
+
+        /** Curve tensions, -1 to 1: 0 is linear, positive moves quickly first, negative slowly first */
+        float attackCurve = 0.0f, decayCurve = 0.0f, releaseCurve = 0.0f;
+
+        bool operator==(const EnvelopeShape& other) const noexcept;
+        bool operator!=(const EnvelopeShape& other) const noexcept { return ! operator==(other); }
+    };
+
+    /**
+     * Cached envelope outline that eases towards a target shape.
+     * Each curved stage is sampled in its own unit space, so a parameter change
+     * only resamples the stage whose tension changed; times and sustain only
+     * move the stages. The outline for the last area drawn is kept too, and
+     * only the stages whose endpoints or curve moved are mapped into it again.
+     * Implicitly constructible from an EnvelopeShape for one-off draws. Not
+     * safe to draw from several threads at once.
+     */
+    class EnvelopePath
+    {
+    public:
+        EnvelopePath();
+        EnvelopePath(const EnvelopeShape& shape);
+
+        /** Set the shape to ease towards */
+        void setTarget(const EnvelopeShape& newTarget) noexcept;
+
+        /** Jump straight to a shape */
+        void setShape(const EnvelopeShape& shape) noexcept;
+
+        /**
+         * Move one step towards the target; call once per frame
+         * @param smoothing Fraction of the remaining distance covered per step (0-1)
+         * @return True if the shape changed and the icon needs repainting
+         */
+        bool advance(float smoothing = 0.35f) noexcept;
+
+        /** The shape currently shown */
+        const EnvelopeShape& getShape() const noexcept { return current; }
+
+        /** Breakpoints of an envelope laid out in an area */
+        struct Layout
+        {
+            juce::Point<float> start, peak, sustainStart, sustainEnd, end;
+        };
+
+        /**
+         * Lay the current shape out in an area
+         * @param area Area from silence (bottom) to full level (top)
+         * @param sustainWidth Fraction of the width given to the sustain stage; 0 leaves out decay and sustain
+         */
+        Layout getLayout(juce::Rectangle<float> area, float sustainWidth = 0.25f) const noexcept;
+
+        /**
+         * The outline for an area, rebuilt only where the shape or area changed since the last call
+         * @param area Area from silence (bottom) to full level (top)
+         * @param sustainWidth As for getLayout()
+         * @return The cached outline; valid until the next call
+         */
+        const juce::Path& getPath(juce::Rectangle<float> area, float sustainWidth = 0.25f) const;
+
+    private:
+        enum Stage { attackStage, decayStage, releaseStage, numStages };
+
+        /** Samples of one stage in unit space: x and progress both 0 to 1 */
+        struct StageCurve
+        {
+            float tension = 0.0f;
+            juce::Array<juce::Point<float>> points;
+        };
+
+        /** One stage of the cached outline, mapped into the area it was last drawn in */
+        struct StageSegment
+        {
+            juce::Point<float> from, to;
+            float tension = 0.0f;
+            juce::Array<juce::Point<float>> points;
+        };
+
+        void updateCurves() noexcept;
+        static void sampleCurve(StageCurve& curve, float tension);
+
+        EnvelopeShape current, target;
+        StageCurve curves[numStages];
+
+        mutable StageSegment segments[numStages];
+        mutable juce::Path path;
+        mutable bool pathHasSustain = false;
+    };
+
+    /**
+     * Envelope icons drawn from real envelope values
+     * @param g Graphics context
+     * @param bounds Icon bounds
+     * @param color Icon color
+     * @param envelope Shape to draw; pass a persistent EnvelopePath when animating
+     */
+    static void drawADSR(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const EnvelopePath& envelope);
+    static void drawAR(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const EnvelopePath& envelope);
+    static void drawEnv1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const EnvelopePath& envelope);
+    static void drawEnv2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const EnvelopePath& envelope);
+    static void drawEnvelopeDisplay(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                    const EnvelopePath& envelope);
+
+    // ============================================================================
+    // PARAMETRIC WAVEFORMS
+    // ============================================================================
+
+    /** Basic oscillator and LFO shapes, in morph order */
+    enum class WaveShape { sine, triangle, saw, square };
+
+    /** Number of WaveShape values */
+    static constexpr int numWaveShapes = 4;
+
+    /** Waveform values to show in the parametric oscillator and LFO icons */
+    struct WaveParameters
+    {
+        WaveShape shape = WaveShape::sine;
+
+        /** Start phase in cycles; animate it to scroll the wave (only the fractional part is used) */
+        float phase = 0.0f;
+
+        /** High fraction of each square cycle, 0 to 1 */
+        float pulseWidth = 0.5f;
+
+        /** Blend towards the next shape in morph order (square wraps to sine), 0 to 1 */
+        float morph = 0.0f;
+
+        /** Number of cycles across the icon, up to 64 */
+        float cycles = 1.0f;
+    };
+
+    /**
+     * Shared, precomputed single-cycle tables for the smooth shapes. Square waves
+     * are evaluated directly so pulse width changes don't need their own tables.
+     */
+    class WaveTables
+    {
+    public:
+        /** Samples per cycle */
+        static constexpr int tableSize = 256;
+
+        /** The shared tables, built on first use */
+        static const WaveTables& getInstance();
+
+        /**
+         * Evaluate a shape
+         * @param shape Shape to evaluate
+         * @param phase Phase in cycles; wrapped into 0-1
+         * @param pulseWidth High fraction of square cycles
+         * @return Value from -1 to 1, rising first for sine and triangle
+         */
+        float getValue(WaveShape shape, float phase, float pulseWidth = 0.5f) const noexcept;
+
+    private:
+        WaveTables();
+
+        // One guard sample at the end of each table so interpolation never wraps
+        float tables[numWaveShapes - 1][tableSize + 1];
+    };
+
+    /**
+     * Build the polyline for a waveform. Points are sampled from WaveTables, with
+     * exact vertical edges at saw resets and square transitions.
+     * @param area Area to fill; +1 maps to its top and -1 to its bottom
+     * @param wave Waveform to draw
+     * @return Open path from the left to the right edge of the area
+     */
+    static juce::Path createWavePath(juce::Rectangle<float> area, const WaveParameters& wave);
+
+    /**
+     * Stroke style suiting a waveform: mitered corners for shapes with vertical edges, rounded otherwise
+     * @param wave Waveform being stroked
+     * @param strokeWidth Line width
+     */
+    static juce::PathStrokeType createWaveStroke(const WaveParameters& wave, float strokeWidth);
+
+    /**
+     * Draw any waveform with a centre line, in the style of drawSineWave() and friends
+     * @param g Graphics context
+     * @param bounds Icon bounds
+     * @param color Icon color
+     * @param wave Waveform to draw
+     */
+    static void drawWaveShape(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                              const WaveParameters& wave);
+
+    /**
+     * Oscillator and LFO icons drawn from real waveform values
+     * @param g Graphics context
+     * @param bounds Icon bounds
+     * @param color Icon color
+     * @param wave Waveform to show
+     */
+    static void drawLFO(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawLFO1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawLFO2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawLFO3(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawOsc1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawOsc2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+    static void drawOsc3(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const WaveParameters& wave);
+
+    // ============================================================================
+    // ICON MORPHING
+    // ============================================================================
+
+    /**
+     * Shape interpolation between two icons, e.g. ToggleOff -> ToggleOn.
+     * Both icons are recorded once and their fills are paired up: each fill in
+     * one icon is matched to the nearest fill in the other, each outline
+     * resampled to a shared vertex count and rotated to its best alignment.
+     * Fills without a partner shrink to their centre and fade out. Drawing a
+     * frame is then a vertex lerp into a reused path and one fill per pair.
+     */
+    class IconMorph
+    {
+    public:
+        /**
+         * Build the correspondence between two icons
+         * @param from Icon shown at position 0
+         * @param to Icon shown at position 1
+         * @param size Icon width and height
+         * @param color Icon color
+         * @param physicalPixelScale Display scale, used to pick the curve flattening tolerance
+         */
+        IconMorph(IconId from, IconId to, juce::Point<float> size, juce::Colour color, float physicalPixelScale = 1.0f);
+
+        /**
+         * Fetch (building if needed) a shared morph; the most recently used 64 are kept
+         * @param from Icon shown at position 0
+         * @param to Icon shown at position 1
+         * @param size Icon width and height
+         * @param color Icon color
+         * @param physicalPixelScale Display scale
+         */
+        static std::shared_ptr<const IconMorph> getCached(IconId from, IconId to, juce::Point<float> size,
+                                                          juce::Colour color, float physicalPixelScale = 1.0f);
+
+        /**
+         * Draw one frame
+         * @param g Graphics context
+         * @param origin Top-left corner of the icon
+         * @param position 0 shows the first icon, 1 the second
+         */
+        void draw(juce::Graphics& g, juce::Point<float> origin, float position) const;
+
+        /** False if either icon uses text, images or clipping; draw() then cross-fades instead */
+        bool canInterpolate() const noexcept { return interpolates; }
+
+        /** Total number of interpolated vertices */
+        int getNumVertices() const noexcept { return fromPoints.size(); }
+
+    private:
+        struct Contour
+        {
+            int firstVertex, numVertices;
+        };
+
+        struct Shape
+        {
+            juce::Colour fromColour, toColour;
+            bool useNonZeroWinding;
+            int firstContour, numContours;
+        };
+
+        IconId fromIcon, toIcon;
+        juce::Point<float> size;
+        juce::Colour color;
+        bool interpolates = true;
+
+        juce::Array<Shape> shapes;
+        juce::Array<Contour> contours;
+        juce::Array<juce::Point<float>> fromPoints, toPoints;
+    };
+
+    /**
+     * Draw a frame of the morph between two icons through the shared IconMorph cache.
+     * Positions of 0 and 1 draw the end icons live, so resting states are exact.
+     * @param g Graphics context
+     * @param from Icon shown at position 0
+     * @param to Icon shown at position 1
+     * @param bounds Icon bounds
+     * @param color Icon color
+     * @param position Morph position, 0 to 1
+     */
+    static void drawMorph(juce::Graphics& g, IconId from, IconId to, juce::Rectangle<float> bounds,
+                          juce::Colour color, float position);
+
+    // ============================================================================
+    // ANIMATION
+    // ============================================================================
+
+    /**
+     * Icon drawn at a point in a loop; phase runs from 0 to 1 and 1 matches 0, so
+     * AnimatedKnob, VisualModulation and Freeze loop seamlessly
+     */
+    using AnimatedDrawFunction = void (*)(juce::Graphics&, juce::Rectangle<float>, juce::Colour, float);
+
+    /**
+     * A looping icon pre-rendered into N frames laid side by side in one image.
+     * Drawing a frame is a single image blit, which suits rows of small
+     * indicators where a few steps per loop are enough.
+     */
+    class AnimationStrip
+    {
+    public:
+        /**
+         * Render every frame of the loop
+         * @param draw Animated icon to render
+         * @param size Icon width and height
+         * @param color Icon color
+         * @param numFrames Frames per loop
+         * @param physicalPixelScale Display scale the strip is rendered at
+         */
+        AnimationStrip(AnimatedDrawFunction draw, juce::Point<float> size, juce::Colour color, int numFrames,
+                       float physicalPixelScale = 1.0f);
+
+        /**
+         * Fetch (rendering if needed) a shared strip; the most recently used 32 are kept
+         * @param draw Animated icon to render
+         * @param size Icon width and height
+         * @param color Icon color
+         * @param numFrames Frames per loop
+         * @param physicalPixelScale Display scale
+         */
+        static std::shared_ptr<const AnimationStrip> getCached(AnimatedDrawFunction draw, juce::Point<float> size,
+                                                               juce::Colour color, int numFrames,
+                                                               float physicalPixelScale = 1.0f);
+
+        /** Frame shown at a phase */
+        int getFrameIndex(float phase) const noexcept;
+
+        int getNumFrames() const noexcept { return frames.size(); }
+
+        /** Pixel memory held by the strip */
+        size_t getMemoryUsage() const noexcept;
+
+        /**
+         * Draw the frame for a phase
+         * @param g Graphics context
+         * @param origin Top-left corner of the icon; snapped to whole physical pixels
+         * @param phase Loop position, wrapped into 0 to 1
+         */
+        void draw(juce::Graphics& g, juce::Point<float> origin, float phase) const;
+
+    private:
+        float scale;
+        juce::Image strip;
+        juce::Array<juce::Image> frames;
+    };
+
+    /**
+     * Shared clock for animated icons, ticked once per display refresh by a
+     * juce::VBlankAttachment on the host component.
+     *
+     * Each animation is an icon area inside some component. Every tick the clock
+     * works out which animations moved to a new frame and repaints just their
+     * areas, so a panel full of animated indicators never repaints whole
+     * components. Animations with a frame count only advance, and so only
+     * repaint, when their frame changes. All phases come from the one clock, so
+     * animations with equal periods stay in step.
+     */
+    class AnimationClock
+    {
+    public:
+        /** Ticks for as long as host is on screen */
+        explicit AnimationClock(juce::Component& host);
+
+        /**
+         * Start animating an icon area
+         * @param owner Component that paints the icon
+         * @param bounds Icon bounds in owner's coordinates
+         * @param periodSeconds Loop length
+         * @param numFrames Steps per loop, or 0 to advance every tick
+         * @return Id for the other calls
+         */
+        int add(juce::Component& owner, juce::Rectangle<float> bounds, double periodSeconds, int numFrames = 0);
+
+        void remove(int animationId);
+
+        /** Move an animation, e.g. from the owner's resized() */
+        void setBounds(int animationId, juce::Rectangle<float> bounds);
+
+        /** Paused animations hold their phase and are not repainted */
+        void setRunning(int animationId, bool shouldRun);
+
+        /**
+         * Phase to paint with, quantised to the animation's frame count
+         * @param animationId Id returned by add()
+         * @return Loop position, 0 to 1
+         */
+        float getPhase(int animationId) const;
+
+        /**
+         * Areas of a component repainted by the most recent tick
+         * @param owner Component to query
+         */
+        juce::RectangleList<int> getDirtyRegion(const juce::Component& owner) const;
+
+        /**
+         * Advance to a time and repaint what changed; called on every vblank, and
+         * can be called directly to drive the clock from elsewhere
+         * @param timeSeconds Current time in seconds
+         */
+        void tick(double timeSeconds);
+
+    private:
+        struct Animation
+        {
+            int id;
+            juce::Component::SafePointer<juce::Component> owner;
+            juce::Rectangle<float> bounds;
+            double periodSeconds, startSeconds;
+            int numFrames;
+            bool running = true;
+            float phase = 0.0f;
+        };
+
+        struct DirtyRegion
+        {
+            juce::Component* owner;
+            juce::RectangleList<int> region;
+        };
+
+        Animation* find(int animationId) noexcept;
+        const Animation* find(int animationId) const noexcept;
+
+        juce::Array<Animation> animations;
+        juce::Array<DirtyRegion> dirtyRegions;
+        double now = 0.0;
+        int nextId = 1;
+        juce::VBlankAttachment vblank;
+
+        JUCE_DECLARE_NON_COPYABLE(AnimationClock)
+    };
+
+    /**
+     * Draw one frame of an animated icon, live or from the shared strip cache
+     * @param g Graphics context
+     * @param draw Animated icon
+     * @param bounds Icon bounds
+     * @param color Icon color
+     * @param phase Loop position, 0 to 1
+     * @param numFrames Frames per loop when drawing from a pre-rendered strip, or 0 to draw live
+     */
+    static void drawAnimated(juce::Graphics& g, AnimatedDrawFunction draw, juce::Rectangle<float> bounds,
+                             juce::Colour color, float phase, int numFrames = 0);
+
+    // ============================================================================
+    // LAYERED ICONS
+    // ============================================================================
+
+    /**
+     * The tones an icon derives from its color. Each recorded fill is sorted by
+     * how its color relates to the one the icon was given:
+     * - primary: the color itself, at any alpha
+     * - secondary: the same hue made brighter, or greyscale (contrasting())
+     * - accent: any other hue, e.g. the yellow meter bar
+     * - warning: a shift to red, e.g. the meter's top bar
+     * - shade: the same hue made darker, e.g. knob pointers and thumb outlines
+     *
+     * Fills with a literal color that doesn't follow the icon's, like the black
+     * Lock keyhole or the ColorPicker swatches, have no role; LayeredIcon keeps
+     * them in fixed layers drawn in their recorded color.
+     */
+    enum class ColorRole { primary, secondary, accent, warning, shade };
+
+    static constexpr int numColorRoles = 5;
+
+    /** Colors the role layers are tinted with when a layered icon is drawn */
+    struct RolePalette
+    {
+        juce::Colour colors[numColorRoles];
+
+        /** A palette built around one color, with the tones the icons themselves favour */
+        static RolePalette fromColor(juce::Colour color);
+
+        juce::Colour operator[](ColorRole role) const noexcept { return colors[(int) role]; }
+    };
+
+    /** Exact rotations and mirrors an icon can be drawn with, from its canonical raster */
+    enum class IconOrientation
+    {
+        normal,
+        flippedHorizontally,
+        flippedVertically,
+        rotated90,              // clockwise
+        rotated180,
+        rotated270,
+        transposed              // mirrored about the top-left to bottom-right diagonal
+    };
+
+    /** How an icon derives from the canonical member of its family */
+    struct IconSymmetry
+    {
+        IconId canonical;
+        IconOrientation orientation;
+    };
+
+    /**
+     * Find the icon an icon is an exact rotation or mirror of. ArrowDown, ArrowLeft
+     * and ArrowRight derive from ArrowUp, ScrollVertical from ScrollHorizontal,
+     * SliderVertical from SliderHorizontal and Upload from Download. Any other
+     * icon, or one whose canonical icon isn't selected, is its own canonical icon.
+     * @param icon Icon identifier
+     */
+    static IconSymmetry getSymmetry(IconId icon) noexcept;
+
+    /**
+     * An icon rasterised once into one alpha mask per color role. Drawing tints
+     * each mask with its palette color, so changing theme, state or palette never
+     * re-rasterises; only size and display scale do.
+     *
+     * Layers are composited in role order rather than the icon's own draw order,
+     * which only matters where differently toned fills overlap. Literal-colored
+     * fills go into one fixed layer per color, drawn after the role layers and
+     * never re-tinted.
+     *
+     * Icons that getSymmetry() derives from another share that icon's masks and
+     * apply their rotation or flip when drawn, so a family of four arrows is
+     * rasterised and stored once.
+     */
+    class LayeredIcon
+    {
+    public:
+        /**
+         * Record an icon and rasterise its role masks
+         * @param icon Icon to rasterise
+         * @param size Icon width and height
+         * @param physicalPixelScale Display scale the masks are rendered at
+         */
+        LayeredIcon(IconId icon, juce::Point<float> size, float physicalPixelScale = 1.0f);
+
+        /**
+         * A variant sharing another icon's masks
+         * @param canonical Layers to share, rasterised at the variant's size with the axes swapped if the orientation swaps them
+         * @param orientation Rotation or flip applied when drawing
+         */
+        LayeredIcon(const LayeredIcon& canonical, IconOrientation orientation);
+
+        /**
+         * Fetch (rasterising if needed) shared masks; the most recently used 128 are kept
+         * @param icon Icon to rasterise
+         * @param size Icon width and height
+         * @param physicalPixelScale Display scale
+         */
+        static std::shared_ptr<const LayeredIcon> getCached(IconId icon, juce::Point<float> size,
+                                                            float physicalPixelScale = 1.0f);
+
+        /**
+         * Sort a recorded fill color into its role
+         * @param recorded Color of the fill
+         * @param reference Color the icon was drawn with
+         */
+        static ColorRole classify(juce::Colour recorded, juce::Colour reference) noexcept;
+
+        /** False if the icon uses clipping, images or layers; draw it live instead */
+        bool isComplete() const noexcept { return complete; }
+
+        /** True if any of the icon's fills have this role */
+        bool hasLayer(ColorRole role) const noexcept { return masks[(int) role].isValid(); }
+
+        /**
+         * Coverage for one role at the display scale, including a margin around the icon bounds.
+         * Variants return the canonical icon's mask, before getOrientation() is applied.
+         */
+        const juce::Image& getMask(ColorRole role) const noexcept { return masks[(int) role]; }
+
+        /** The rotation or flip applied to the masks when drawing */
+        IconOrientation getOrientation() const noexcept { return orientation; }
+
+        /** Top-left of the masks relative to the icon origin, in logical pixels */
+        juce::Point<float> getMaskOffset() const noexcept { return maskOffset; }
+
+        float getScale() const noexcept { return scale; }
+
+        /**
+         * Pixel memory held by the masks. Variants share their canonical icon's
+         * masks and only count the oriented copies composite() has built.
+         */
+        size_t getMemoryUsage() const noexcept;
+
+        /**
+         * Composite the layers
+         * @param g Graphics context
+         * @param origin Top-left corner of the icon
+         * @param palette Color for each role
+         */
+        void draw(juce::Graphics& g, juce::Point<float> origin, const RolePalette& palette) const;
+
+        /**
+         * Composite the layers straight into pixels with compositeMask(), e.g. when
+         * filling a grid of icons into one backing image. The kernels walk rows, so
+         * a variant keeps rotated or flipped copies of its masks, built on its first
+         * composite() and reused after that.
+         * @param dest ARGB pixels at the display scale the icon was rasterised for
+         * @param position Icon origin in dest, in physical pixels
+         * @param palette Color for each role
+         */
+        void composite(juce::Image::BitmapData& dest, juce::Point<int> position, const RolePalette& palette) const;
+
+    private:
+        /** Coverage of the fills drawn in one literal color */
+        struct FixedLayer
+        {
+            juce::Colour color;
+            juce::Image mask;
+        };
+
+        void buildOrientedMasks() const;
+
+        juce::Image masks[numColorRoles];
+        juce::Array<FixedLayer> fixedLayers;
+
+        // Row-ordered copies of masks and fixed layer masks for composite(), variants only
+        mutable std::once_flag orientedOnce;
+        mutable std::atomic<bool> orientedBuilt { false };
+        mutable juce::Image orientedMasks[numColorRoles];
+        mutable juce::Array<juce::Image> orientedFixedMasks;
+
+        juce::Point<float> maskOffset;
+        juce::Point<float> maskExtent;      // icon size plus both margins, in physical pixels, before orientation
+        float scale;
+        IconOrientation orientation = IconOrientation::normal;
+        bool complete = true;
+    };
+
+    /**
+     * Draw an icon from its shared role masks, falling back to a live draw with the
+     * primary color for icons that can't be layered
+     * @param g Graphics context
+     * @param icon Icon to draw
+     * @param bounds Icon bounds
+     * @param palette Color for each role
+     */
+    static void drawLayered(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, const RolePalette& palette);
+
+    // ============================================================================
+    // MASK COMPOSITING
+    // ============================================================================
+
+    /** Instruction sets the mask compositing kernel can use */
+    enum class SimdLevel { scalar, sse2, avx2, neon };
+
+    /** The fastest kernel this CPU supports, picked once at first use */
+    static SimdLevel getSimdLevel();
+
+    /**
+     * Tint an 8-bit coverage mask with a color and blend it over premultiplied
+     * ARGB pixels (source-over), the inner loop of cached icon blits. Every
+     * kernel produces bit-identical results; the vector ones do 8 pixels per
+     * iteration and skip runs of empty coverage.
+     * @param dest ARGB pixels to draw into
+     * @param destPosition Where the top-left of maskArea lands in dest
+     * @param mask SingleChannel coverage
+     * @param maskArea Part of the mask to composite; clipped to both images
+     * @param color Tint, including its alpha
+     */
+    static void compositeMask(juce::Image::BitmapData& dest, juce::Point<int> destPosition,
+                              const juce::Image::BitmapData& mask, juce::Rectangle<int> maskArea, juce::Colour color);
+
+    /**
+     * As above, with an explicit kernel for comparisons and benchmarks
+     * @param level Kernel to use; must be scalar or no better than getSimdLevel()
+     */
+    static void compositeMask(juce::Image::BitmapData& dest, juce::Point<int> destPosition,
+                              const juce::Image::BitmapData& mask, juce::Rectangle<int> maskArea, juce::Colour color,
+                              SimdLevel level);
+
+    /**
+     * Time every supported kernel against Graphics::drawImageAt() with
+     * fillAlphaChannelWithCurrentBrush, blitting a grid of icon masks
+     * @param maskSize Icon size in pixels (default: 48)
+     * @param iterations Grids blitted per method (default: 500)
+     * @return Plain-text table, one method per line
+     */
+    static juce::String createCompositeBenchmark(int maskSize = 48, int iterations = 500);
+
+    // ============================================================================
+    // ICON COMPONENTS
+    // ============================================================================
+
+    /**
+     * One icon drawn from the shared LayeredIcon cache. The masks are looked up
+     * again only when the drawn size or display scale changes, so a paint is just
+     * the mask blits, with no cache lookup or lock.
+     */
+    class CachedIcon
+    {
+    public:
+        explicit CachedIcon(IconId icon);
+
+        void setIcon(IconId newIcon);
+        IconId getIcon() const noexcept { return icon; }
+
+        /**
+         * Draw the icon
+         * @param g Graphics context
+         * @param bounds Icon bounds
+         * @param palette Color for each role
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, const RolePalette& palette);
+
+    private:
+        IconId icon;
+        std::shared_ptr<const LayeredIcon> layers;
+        juce::Point<float> size;
+        float scale = 0.0f;
+    };
+
+    /**
+     * A component that shows one icon.
+     *
+     * Colors come from the ColourIds, so a LookAndFeel or theme change is just a
+     * repaint with a new palette. Rasterising only happens when the size or
+     * display scale changes. Set an opaque backgroundColourId to mark the
+     * component opaque, so the parent behind it isn't repainted.
+     */
+    class IconComponent : public juce::Component
+    {
+    public:
+        /**
+         * Colors for the icon's role layers. Roles without a color are derived
+         * from iconColourId through RolePalette::fromColor().
+         */
+        enum ColourIds
+        {
+            iconColourId            = 0x2f1c000,
+            iconSecondaryColourId   = 0x2f1c001,
+            iconAccentColourId      = 0x2f1c002,
+            iconWarningColourId     = 0x2f1c003,
+            backgroundColourId      = 0x2f1c004,
+            iconShadeColourId       = 0x2f1c005
+        };
+
+        explicit IconComponent(IconId icon);
+
+        /** Change the icon; only the icon area is repainted */
+        void setIcon(IconId newIcon);
+        IconId getIcon() const noexcept { return cachedIcon.getIcon(); }
+
+        /**
+         * Set the space around the icon
+         * @param paddingRatio Padding as a proportion of the component size, as for applyPadding()
+         */
+        void setPadding(float paddingRatio);
+
+        /** Where the icon is drawn, in local coordinates */
+        juce::Rectangle<float> getIconBounds() const;
+
+        void paint(juce::Graphics& g) override;
+        void colourChanged() override;
+        void lookAndFeelChanged() override;
+        void enablementChanged() override;
+
+    private:
+        void updateColours();
+
+        CachedIcon cachedIcon;
+        RolePalette palette;
+        float padding = 0.1f;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IconComponent)
+    };
+
+    /**
+     * A button that shows one icon, colored per state with getStateColor().
+     * Hover and press only change the palette the cached masks are tinted with,
+     * so state transitions are blits. Uses IconComponent's ColourIds.
+     */
+    class IconButton : public juce::Button
+    {
+    public:
+        IconButton(const juce::String& name, IconId icon);
+
+        void setIcon(IconId newIcon);
+        IconId getIcon() const noexcept { return cachedIcon.getIcon(); }
+
+        /** @param paddingRatio Padding as a proportion of the button size, as for applyPadding() */
+        void setPadding(float paddingRatio);
+
+        juce::Rectangle<float> getIconBounds() const;
+
+        void paintButton(juce::Graphics& g, bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override;
+        void colourChanged() override;
+        void lookAndFeelChanged() override;
+
+    private:
+        void updateColours();
+
+        CachedIcon cachedIcon;
+        RolePalette palette;
+        float padding = 0.15f;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IconButton)
+    };
+
+    // ============================================================================
+    // LOOK AND FEEL
+    // ============================================================================
+
+    /**
+     * Widget parts drawn with pack icons through the shared LayeredIcon cache,
+     * used by FancyIconPack::LookAndFeel. Each mirrors the LookAndFeel_V4 layout
+     * and colour ids of the hook it serves.
+     */
+    class LookAndFeelIcons
+    {
+    public:
+        LookAndFeelIcons() = delete;
+
+        /** Outline box plus Check when ticked, colored from ToggleButton::tickColourId */
+        static void drawTickBox(juce::Graphics& g, juce::Component& component, juce::Rectangle<float> area,
+                                bool ticked, bool isEnabled, bool isHighlighted, bool isPressed);
+
+        /**
+         * Check and ArrowRight for a popup menu item whose text has already been drawn
+         * @param lookAndFeel Supplies the popup menu font, which sizes the icons
+         */
+        static void drawPopupMenuItemIcons(juce::LookAndFeel& lookAndFeel, juce::Graphics& g,
+                                           juce::Rectangle<int> area, bool isActive, bool isHighlighted,
+                                           bool isTicked, bool hasSubMenu, const juce::Colour* textColour);
+
+        /** Box, outline and Dropdown arrow */
+        static void drawComboBox(juce::Graphics& g, int width, int height, juce::ComboBox& box);
+
+        /**
+         * IconButton showing Minus, Fullscreen or Close for a DocumentWindow::TitleBarButtons value
+         * @param lookAndFeel Supplies DocumentWindow::textColourId, which colors the icon to match the title
+         */
+        static juce::Button* createDocumentWindowButton(juce::LookAndFeel& lookAndFeel, int buttonType);
+
+        /** ArrowDown when open, ArrowRight when closed */
+        static void drawTreeviewPlusMinusBox(juce::Graphics& g, juce::Rectangle<float> area,
+                                             juce::Colour backgroundColour, bool isOpen, bool isMouseOver);
+    };
+
+    /**
+     * A LookAndFeel mixin that draws standard widget glyphs (tick boxes, popup
+     * menu ticks and submenu arrows, combo box arrows, window title bar buttons
+     * and tree view disclosure boxes) with pack icons from the shared raster
+     * cache. Large menus and lists then blit a few cached masks per row instead
+     * of filling vector paths.
+     *
+     * @code
+     * FancyIconPack::LookAndFeel<> lookAndFeel;                     // over LookAndFeel_V4
+     * FancyIconPack::LookAndFeel<MyLookAndFeel> customLookAndFeel;  // over any V2-derived class
+     * @endcode
+     */
+    template <typename BaseLookAndFeel = juce::LookAndFeel_V4>
+    class LookAndFeel : public BaseLookAndFeel
+    {
+    public:
+        using BaseLookAndFeel::BaseLookAndFeel;
+
+        void drawTickBox(juce::Graphics& g, juce::Component& component, float x, float y, float w, float h,
+                         bool ticked, bool isEnabled, bool shouldDrawButtonAsHighlighted,
+                         bool shouldDrawButtonAsDown) override
+        {
+            LookAndFeelIcons::drawTickBox(g, component, { x, y, w, h }, ticked, isEnabled,
+                                          shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+        }
+
+        void drawPopupMenuItem(juce::Graphics& g, const juce::Rectangle<int>& area, bool isSeparator, bool isActive,
+                               bool isHighlighted, bool isTicked, bool hasSubMenu, const juce::String& text,
+                               const juce::String& shortcutKeyText, const juce::Drawable* icon,
+                               const juce::Colour* textColour) override
+        {
+            // The base class lays out and draws the row; only its tick and arrow are replaced
+            BaseLookAndFeel::drawPopupMenuItem(g, area, isSeparator, isActive, isHighlighted, false, false,
+                                               text, shortcutKeyText, icon, textColour);
+
+            if (! isSeparator)
+                LookAndFeelIcons::drawPopupMenuItemIcons(*this, g, area, isActive, isHighlighted,
+                                                         isTicked && icon == nullptr, hasSubMenu, textColour);
+        }
+
+        void drawComboBox(juce::Graphics& g, int width, int height, bool, int, int, int, int,
+                          juce::ComboBox& box) override
+        {
+            LookAndFeelIcons::drawComboBox(g, width, height, box);
+        }
+
+        juce::Button* createDocumentWindowButton(int buttonType) override
+        {
+            return LookAndFeelIcons::createDocumentWindowButton(*this, buttonType);
+        }
+
+        void drawTreeviewPlusMinusBox(juce::Graphics& g, const juce::Rectangle<float>& area,
+                                      juce::Colour backgroundColour, bool isOpen, bool isMouseOver) override
+        {
+            LookAndFeelIcons::drawTreeviewPlusMinusBox(g, area, backgroundColour, isOpen, isMouseOver);
+        }
+    };
+
+    // ============================================================================
+    // VALUE CONTROLS
+    // ============================================================================
+
+    /** Sweep of drawKnob's pointer in radians clockwise from 12 o'clock, matching a default rotary Slider */
+    static constexpr float knobStartAngle = juce::MathConstants<float>::pi * 1.25f;
+    static constexpr float knobEndAngle = juce::MathConstants<float>::pi * 2.75f;
+
+    /** The static parts of the value-driven control icons: body, track, scale marks and labels */
+    static void drawKnobFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawSliderHorizontalFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawSliderVerticalFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawTunerFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawModDepthFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawModAmountFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+
+    /**
+     * The dynamic parts, drawn over the matching frame from a normalised value (0 to 1).
+     * The tuner is in tune at 0.5, flat below and sharp above.
+     */
+    static void drawKnobPointer(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+    static void drawSliderHorizontalThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+    static void drawSliderVerticalThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+    static void drawTunerNeedle(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+    static void drawModDepthWave(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+    static void drawModAmountThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+
+    /** Signature shared by the dynamic layers above */
+    using ValueDrawFunction = void (*)(juce::Graphics&, juce::Rectangle<float>, juce::Colour, float);
+
+    /**
+     * A value-driven control icon split into two layers. The static frame is
+     * rasterised once per size, scale and color and shared by every ValueIcon
+     * drawing it; the dynamic layer is drawn live from the current value. A
+     * value change during automation playback then costs one image blit plus
+     * the few vertices of a pointer, thumb or needle.
+     */
+    class ValueIcon
+    {
+    public:
+        /**
+         * @param frame Static layer, e.g. drawKnobFrame
+         * @param valueLayer Dynamic layer, e.g. drawKnobPointer
+         */
+        ValueIcon(DrawFunction frame, ValueDrawFunction valueLayer);
+
+        static ValueIcon knob()             { return { &drawKnobFrame, &drawKnobPointer }; }
+        static ValueIcon sliderHorizontal() { return { &drawSliderHorizontalFrame, &drawSliderHorizontalThumb }; }
+        static ValueIcon sliderVertical()   { return { &drawSliderVerticalFrame, &drawSliderVerticalThumb }; }
+        static ValueIcon tuner()            { return { &drawTunerFrame, &drawTunerNeedle }; }
+        static ValueIcon modDepth()         { return { &drawModDepthFrame, &drawModDepthWave }; }
+        static ValueIcon modAmount()        { return { &drawModAmountFrame, &drawModAmountThumb }; }
+
+        /**
+         * Draw the cached frame and the value layer over it
+         * @param g Graphics context
+         * @param bounds Icon bounds; the origin is snapped to whole physical pixels
+         * @param color Icon color
+         * @param value Normalised value, 0 to 1
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value);
+
+        /** Bytes held by the frame raster this icon currently shares */
+        size_t getMemoryUsage() const noexcept;
+
+    private:
+        DrawFunction frame;
+        ValueDrawFunction valueLayer;
+
+        // Only refetched from the shared cache when size, scale or color change
+        std::shared_ptr<const juce::Image> frameImage;
+        juce::Point<float> size;
+        float scale = 0.0f;
+        juce::Colour frameColor;
+    };
+
+    // ============================================================================
+    // LIVE SPECTRUM
+    // ============================================================================
+
+    /**
+     * Reduces a block of FFT magnitudes to log-spaced bars. The bin range of
+     * every bar is worked out once, in the constructor, so process() is just a
+     * SIMD max or average over each range.
+     */
+    class SpectrumBinning
+    {
+    public:
+        /** How the bins that fall into one bar are combined */
+        enum class Mode
+        {
+            peak,     // Loudest bin, so narrow tones stay visible in wide high bars
+            average   // Mean of the bins, closer to the band's energy
+        };
+
+        /**
+         * @param numFFTBins Magnitudes per block, usually fftSize / 2 + 1
+         * @param sampleRate Sample rate the FFT ran at
+         * @param numBars Number of bars to reduce to
+         * @param minFrequency Lower edge of the first bar in Hz
+         * @param maxFrequency Upper edge of the last bar in Hz, clamped to Nyquist
+         * @param mode How bins are combined
+         */
+        SpectrumBinning(int numFFTBins, double sampleRate, int numBars, float minFrequency = 20.0f,
+                        float maxFrequency = 20000.0f, Mode mode = Mode::peak);
+
+        int getNumBars() const noexcept { return ranges.size(); }
+        int getNumFFTBins() const noexcept { return numBins; }
+
+        /**
+         * Reduce one block; never allocates
+         * @param magnitudes getNumFFTBins() linear magnitudes
+         * @param bars Receives getNumBars() linear magnitudes
+         */
+        void process(const float* magnitudes, float* bars) const noexcept;
+
+    private:
+        struct BinRange
+        {
+            int start, end;
+        };
+
+        juce::Array<BinRange> ranges;
+        int numBins;
+        Mode mode;
+    };
+
+    /**
+     * Message thread state of a live spectrum badge: per-bar smoothing and
+     * peak-hold caps. Bars rise immediately and fall at the decay rate. Each
+     * cap holds the bar's highest level for a while, then falls. Storage is
+     * sized in the constructor, so neither update() nor draw() allocates.
+     */
+    class LiveSpectrum
+    {
+    public:
+        /** Spectrum response */
+        struct Ballistics
+        {
+            float decayDbPerSecond = 36.0f;
+            float peakHoldSeconds = 1.0f;
+
+            /** Levels mapped to the bottom and top of the badge */
+            float floorDb = -72.0f, ceilingDb = 0.0f;
+        };
+
+        explicit LiveSpectrum(int numBars = 8);
+        LiveSpectrum(int numBars, const Ballistics& ballistics);
+
+        int getNumBars() const noexcept { return bars.size(); }
+
+        /**
+         * Advance the smoothing and peak caps
+         * @param barMagnitudes getNumBars() linear magnitudes from SpectrumBinning::process(),
+         *                      or nullptr if no new block arrived
+         * @param elapsedSeconds Time since the previous update
+         * @return True if anything visible changed
+         */
+        bool update(const float* barMagnitudes, float elapsedSeconds);
+
+        /**
+         * Draw the bars and peak caps, laid out like drawSpectrumDisplay
+         * @param g Graphics context
+         * @param bounds Badge bounds
+         * @param color Base color
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+        /** Drop all levels and held peaks */
+        void reset();
+
+    private:
+        struct Bar
+        {
+            float levelDb, heldDb, holdRemaining;
+        };
+
+        float toProportion(float db) const noexcept;
+
+        Ballistics ballistics;
+        juce::Array<Bar> bars;
+
+        static constexpr float minimumDb = -100.0f;
+    };
+
+    // ============================================================================
+    // WAVEFORM PYRAMID
+    // ============================================================================
+
+    /**
+     * Multi-resolution min/max summary of a mono sample stream, for sample
+     * thumbnails. Level 0 holds the min and max of every baseBlockSize samples,
+     * and each level above halves the one below. Levels are extended as
+     * samples arrive. A draw reads the coarsest level whose blocks still fit
+     * inside one pixel column, so it costs O(width) whatever the zoom, and it
+     * never touches the raw samples. Zooming in past level 0 shows whole blocks.
+     * addSamples() and the readers may run on different threads, but they share
+     * a lock and addSamples() grows the levels, so feed it from a loader or
+     * message thread, never the audio thread; live input should go through a
+     * FIFO drained off the audio thread.
+     */
+    class WaveformPyramid
+    {
+    public:
+        /** @param baseBlockSize Samples summarised by each level 0 entry */
+        explicit WaveformPyramid(int baseBlockSize = 64);
+
+        /**
+         * Append samples, extending every level they complete. Locks and may
+         * allocate, so don't call this from the audio thread.
+         * @param samples Sample data
+         * @param numSamples Number of samples
+         */
+        void addSamples(const float* samples, int numSamples);
+
+        /** Drop all samples */
+        void clear();
+
+        /** Number of samples added so far */
+        juce::int64 getNumSamples() const;
+
+        /**
+         * Min and max of each of numColumns equal slices of a sample range
+         * @param sampleRange Samples to cover
+         * @param numColumns Number of slices
+         * @param columns Receives numColumns ranges; (0, 0) where no samples have arrived
+         */
+        void getColumns(juce::Range<juce::int64> sampleRange, int numColumns, juce::Range<float>* columns) const;
+
+        /**
+         * Draw a sample range as one min/max bar per physical pixel column, with a centre line
+         * @param g Graphics context
+         * @param bounds Thumbnail bounds
+         * @param color Waveform color
+         * @param sampleRange Samples to show
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                  juce::Range<juce::int64> sampleRange) const;
+
+        /** Draw every sample added so far */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+        /** Bytes held by all levels */
+        size_t getMemoryUsage() const;
+
+    private:
+        void addBlock(int level, juce::Range<float> block);
+        void addRange(int level, juce::int64 start, juce::int64 end, juce::Range<float>& result, bool& found) const;
+
+        const int baseBlockSize;
+        juce::Array<juce::Array<juce::Range<float>>> levels;
+        juce::Range<float> pending;
+        int numPending = 0;
+        juce::int64 numSamples = 0;
+        juce::CriticalSection lock;
+
+        JUCE_DECLARE_NON_COPYABLE(WaveformPyramid)
+    };
+
+    // ============================================================================
+    // PATCH CABLES
+    // ============================================================================
+
+    /**
+     * Renderer for the live cables of a modular patch view, styled like
+     * drawPatchCable. Each cable is a cubic that sags between two jacks. Its
+     * control points are kept in structure-of-arrays form. Moving a jack only
+     * updates that cable's control points, bounds and grid cells. The cable is
+     * flattened and stroked again at its next draw, and only if it's visible.
+     * draw() culls against the clip region through a uniform grid, then fills
+     * all visible cables of one color with a single call.
+     */
+    class PatchCables
+    {
+    public:
+        /**
+         * @param thickness Cable thickness in pixels
+         * @param slack Sag below the straight line between the jacks, as a proportion of its length
+         * @param gridCellSize Size of the culling grid's cells in pixels
+         */
+        explicit PatchCables(float thickness = 3.0f, float slack = 0.25f, int gridCellSize = 128);
+
+        /**
+         * Add a cable
+         * @return Cable id, stable until the cable is removed
+         */
+        int addCable(juce::Point<float> start, juce::Point<float> end, juce::Colour color);
+
+        /** Remove a cable; its id may be reused by a later addCable() */
+        void removeCable(int cableId);
+
+        /** Remove every cable */
+        void clear();
+
+        /**
+         * Move a cable's jacks. Cheap: the cable is only flattened again when next drawn.
+         * @return Area to repaint, covering the cable before and after, or empty if nothing moved
+         */
+        juce::Rectangle<int> setEndpoints(int cableId, juce::Point<float> start, juce::Point<float> end);
+
+        /** Change a cable's color; @return area to repaint */
+        juce::Rectangle<int> setColour(int cableId, juce::Colour color);
+
+        /** Area a cable can cover, from the hull of its control points */
+        juce::Rectangle<float> getCableBounds(int cableId) const;
+
+        int getNumCables() const noexcept { return numCables; }
+
+        /**
+         * Draw every cable that intersects the clip region
+         * @param g Graphics context, in the coordinates the endpoints were given in
+         */
+        void draw(juce::Graphics& g);
+
+    private:
+        enum Flags : juce::uint8
+        {
+            alive = 1,
+            outlineStale = 2
+        };
+
+        void setControlPoints(int cableId, juce::Point<float> start, juce::Point<float> end);
+        void updateBounds(int cableId);
+        void addToGrid(int cableId);
+        void removeFromGrid(int cableId);
+        void updateOutline(int cableId);
+        juce::Range<int> getCellRange(float start, float end) const noexcept;
+
+        static juce::int64 getCellKey(int x, int y) noexcept
+        {
+            return ((juce::int64) x << 32) | (juce::uint32) y;
+        }
+
+        float thickness, slack;
+        int cellSize;
+        int numCables = 0;
+
+        // Control points, one entry per cable slot
+        juce::Array<float> x0, y0, x1, y1, x2, y2, x3, y3;
+
+        juce::Array<juce::Colour> colours;
+        juce::Array<juce::Rectangle<float>> bounds;
+        juce::Array<juce::Path> outlines;
+        juce::Array<juce::uint8> flags;
+        juce::Array<juce::uint32> drawStamps;
+        juce::Array<int> freeSlots;
+
+        std::unordered_map<juce::int64, juce::Array<int>> grid;
+
+        // Reused between draws so culling and batching don't allocate once warmed up
+        juce::Array<int> visible;
+        juce::Path batch;
+        juce::uint32 currentStamp = 0;
+
+        JUCE_DECLARE_NON_COPYABLE(PatchCables)
+    };
+
+    // ============================================================================
+    // LIVE MOD MATRIX
+    // ============================================================================
+
+    /**
+     * Data-driven modulation matrix: one cell per source/destination pair, with
+     * the cell's intensity showing its depth. Depths are kept at 8-bit
+     * resolution. A dirty bitset records which cells changed visibly since the
+     * last popDirtyRegion(). The grid frame is rasterised once per size, scale
+     * and color, and draw() only fills the cells inside the clip region. A
+     * frame where a few depths moved repaints just those cells.
+     */
+    class LiveModMatrix
+    {
+    public:
+        LiveModMatrix(int numSources, int numDestinations);
+
+        int getNumSources() const noexcept { return numSources; }
+        int getNumDestinations() const noexcept { return numDestinations; }
+
+        /**
+         * Set one routing's depth
+         * @param source Row
+         * @param destination Column
+         * @param depth Bipolar depth, -1 to 1; negative depths use the opposite hue
+         */
+        void setDepth(int source, int destination, float depth);
+
+        /** Set every depth from a row-major array of numSources * numDestinations values */
+        void setDepths(const float* depths);
+
+        /** Depth as displayed, i.e. at 8-bit resolution */
+        float getDepth(int source, int destination) const;
+
+        /** True if any cell changed since the last popDirtyRegion() */
+        bool isDirty() const noexcept { return ! dirty.isZero(); }
+
+        /**
+         * Area covering the cells changed since the last call, for Component::repaint(),
+         * and clear the dirty set
+         * @param bounds Matrix bounds
+         */
+        juce::RectangleList<int> popDirtyRegion(juce::Rectangle<float> bounds);
+
+        /** Bounds of one cell, inside the grid lines */
+        juce::Rectangle<float> getCellBounds(juce::Rectangle<float> bounds, int source, int destination) const;
+
+        /**
+         * Draw the cached grid frame and the cells inside the clip region
+         * @param g Graphics context
+         * @param bounds Matrix bounds; the origin is snapped to whole physical pixels
+         * @param color Base color
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+
+    private:
+        void updateFrame(juce::Rectangle<float> bounds, juce::Colour color, float scale);
+
+        int numSources, numDestinations;
+        juce::Array<juce::int8> cells;
+        juce::BigInteger dirty;
+
+        juce::Image frame;
+        juce::Point<float> frameSize;
+        float frameScale = 0.0f;
+        juce::Colour frameColor;
+    };
+
+    // ============================================================================
+    // GRAIN CLOUD
+    // ============================================================================
+
+    /**
+     * Lock-free handover of a granular engine's active grains from the audio
+     * thread to the message thread, as structure-of-arrays. Three buffers are
+     * rotated, so neither side ever waits: publish() copies into the back buffer
+     * and swaps it in, and update() takes the newest published buffer.
+     */
+    class GrainSnapshot
+    {
+    public:
+        /** @param maxGrains Most grains a single snapshot can hold */
+        explicit GrainSnapshot(int maxGrains = 512);
+
+        /**
+         * Publish the current grains. Audio thread safe: never blocks or allocates.
+         * Grains past maxGrains are dropped.
+         * @param positions Grain positions in the source, 0 to 1
+         * @param sizes Grain lengths, 0 to 1
+         * @param amplitudes Grain amplitudes, 0 to 1
+         * @param pans Stereo positions, -1 to 1, or nullptr
+         * @param numGrains Number of grains
+         */
+        void publish(const float* positions, const float* sizes, const float* amplitudes, const float* pans,
+                     int numGrains) noexcept;
+
+        /**
+         * Take the newest published grains, on the message thread
+         * @return False if nothing was published since the last call
+         */
+        bool update() noexcept;
+
+        int getNumGrains() const noexcept { return buffers[readIndex].numGrains; }
+        const float* getPositions() const noexcept { return buffers[readIndex].positions; }
+        const float* getSizes() const noexcept { return buffers[readIndex].sizes; }
+        const float* getAmplitudes() const noexcept { return buffers[readIndex].amplitudes; }
+
+        /** Stereo positions, or nullptr if the last publish() had none */
+        const float* getPans() const noexcept { return buffers[readIndex].hasPans ? buffers[readIndex].pans : nullptr; }
+
+    private:
+        struct Buffer
+        {
+            juce::HeapBlock<float> storage;
+            float* positions = nullptr;
+            float* sizes = nullptr;
+            float* amplitudes = nullptr;
+            float* pans = nullptr;
+            int numGrains = 0;
+            bool hasPans = false;
+        };
+
+        // Index of the published buffer, plus freshBit while the reader hasn't taken it
+        static constexpr int freshBit = 4;
+
+        const int capacity;
+        Buffer buffers[3];
+        int writeIndex = 0, readIndex = 1;
+        std::atomic<int> published { 2 };
+
+        JUCE_DECLARE_NON_COPYABLE(GrainSnapshot)
+    };
+
+    /**
+     * Draws live grains in drawGranular's style. Grains are grouped into
+     * alpha buckets by amplitude, and each bucket's circles go into one path,
+     * so hundreds of grains cost numAlphaBuckets fills. Paths are kept
+     * between draws, so nothing allocates once they have grown to size.
+     */
+    class GrainCloud
+    {
+    public:
+        static constexpr int numAlphaBuckets = 8;
+
+        GrainCloud() = default;
+
+        /**
+         * Draw the grains of a snapshot
+         * @param g Graphics context
+         * @param bounds Cloud bounds; x follows position, y follows pan
+         * @param color Base color
+         * @param snapshot Grains to draw, as of its last update()
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const GrainSnapshot& snapshot);
+
+        /** Draw grains from structure-of-arrays data; see GrainSnapshot::publish() for the arrays */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, const float* positions,
+                  const float* sizes, const float* amplitudes, const float* pans, int numGrains);
+
+    private:
+        juce::Path buckets[numAlphaBuckets];
+
+        JUCE_DECLARE_NON_COPYABLE(GrainCloud)
+    };
+
+    // ============================================================================
+    // VOICE ACTIVITY
+    // ============================================================================
+
+    class VoiceActivityView;
+
+    /**
+     * Voice allocation state written by the audio thread: an atomic bitmap of
+     * active voices and one packed byte per voice holding its envelope stage
+     * and a 5-bit level. Every write is a single relaxed atomic store or
+     * fetch-or/and, so the audio thread never blocks.
+     */
+    class VoiceActivity
+    {
+    public:
+        static constexpr int maxVoices = 128;
+
+        enum class Stage : juce::uint8 { idle, attack, decay, sustain, release };
+
+        /**
+         * Publish one voice's state. Audio thread safe.
+         * @param voice Voice index, below maxVoices
+         * @param stage Envelope stage; idle marks the voice inactive
+         * @param level Envelope level, 0 to 1
+         */
+        void setVoice(int voice, Stage stage, float level) noexcept;
+
+        /** Mark every voice inactive. Audio thread safe. */
+        void clear() noexcept;
+
+        /** True if the voice is active */
+        bool isActive(int voice) const noexcept;
+
+        /** The voice's packed state: stage in the top 3 bits, level in the low 5; 0 when inactive */
+        juce::uint8 getPackedState(int voice) const noexcept;
+
+        static Stage getStage(juce::uint8 packed) noexcept { return static_cast<Stage>(packed >> 5); }
+        static float getLevel(juce::uint8 packed) noexcept { return (packed & 31) / 31.0f; }
+
+    private:
+        friend class VoiceActivityView;
+
+        static constexpr int numWords = maxVoices / 64;
+
+        std::atomic<juce::uint64> activeBits[numWords] {};
+        std::atomic<juce::uint8> states[maxVoices] {};
+    };
+
+    /**
+     * Message thread view of a VoiceActivity: one cell per voice showing its
+     * stage and level. update() compares only voices that are active now or
+     * were active at the last update, and marks those whose packed state changed.
+     * popDirtyRegion() then turns them into repaint areas, so a timer tick
+     * repaints only the changed voice cells.
+     */
+    class VoiceActivityView
+    {
+    public:
+        /** @param numVoices Voices to show, up to VoiceActivity::maxVoices */
+        explicit VoiceActivityView(int numVoices = 16);
+
+        int getNumVoices() const noexcept { return numVoices; }
+
+        /**
+         * Read the latest voice states
+         * @return True if any shown voice changed
+         */
+        bool update(const VoiceActivity& activity);
+
+        /**
+         * Area covering the voices changed since the last call, for Component::repaint(),
+         * and clear the dirty set
+         * @param bounds View bounds
+         */
+        juce::RectangleList<int> popDirtyRegion(juce::Rectangle<float> bounds);
+
+        /** Bounds of one voice's cell; voices fill rows left to right */
+        juce::Rectangle<float> getCellBounds(juce::Rectangle<float> bounds, int voice) const;
+
+        /**
+         * Draw the voice cells inside the clip region
+         * @param g Graphics context
+         * @param bounds View bounds
+         * @param color Base color
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+    private:
+        int getNumColumns(juce::Rectangle<float> bounds) const noexcept;
+
+        int numVoices;
+        juce::uint64 previousBits[VoiceActivity::numWords] {};
+        juce::uint8 shownStates[VoiceActivity::maxVoices] {};
+        juce::BigInteger dirty;
+    };
+
+    // ============================================================================
+    // AUTOMATION THUMBNAIL
+    // ============================================================================
+
+    /**
+     * A parameter's automation breakpoints, drawn as a clip thumbnail in the
+     * style of drawAutomationLane. Breakpoints are kept sorted by time in
+     * chunks of up to 128. Each chunk caches its lowest and highest point, so
+     * an edit only rescans the one chunk it touches. A draw finds the visible
+     * range by binary search. It then reduces each pixel column to its first,
+     * lowest, highest and last point, reading whole chunks from their cached
+     * extremes. The polyline has at most four points per column however many
+     * breakpoints there are, and no peak is lost. Message thread only.
+     */
+    class AutomationThumbnail
+    {
+    public:
+        struct Breakpoint
+        {
+            double time;
+            float value;    // 0 to 1
+        };
+
+        AutomationThumbnail() = default;
+
+        /**
+         * Replace all breakpoints
+         * @param points Breakpoints sorted by time
+         * @param numPoints Number of breakpoints
+         */
+        void setBreakpoints(const Breakpoint* points, int numPoints);
+
+        /**
+         * Insert a breakpoint after any others at the same time
+         * @return Its index
+         */
+        int addBreakpoint(double time, float value);
+
+        /** Remove the breakpoint at an index */
+        void removeBreakpoint(int index);
+
+        /**
+         * Change a breakpoint's time and value
+         * @return Its new index
+         */
+        int moveBreakpoint(int index, double newTime, float newValue);
+
+        /** Remove all breakpoints */
+        void clear();
+
+        int getNumBreakpoints() const noexcept { return numBreakpoints; }
+        Breakpoint getBreakpoint(int index) const;
+
+        /** Indices of the breakpoints inside a time range */
+        juce::Range<int> getVisibleRange(juce::Range<double> timeRange) const;
+
+        /**
+         * The decimated curve for a time range, in area coordinates. It includes
+         * the breakpoints either side of the range, so the line runs off the edges,
+         * and holds the first and last values out to the area's edges.
+         * @param timeRange Time shown across the area's width
+         * @param area Value 0 maps to its bottom and 1 to its top
+         * @param numColumns Columns to decimate into, normally the physical pixel width
+         * @param polyline Receives the points, replacing its contents
+         */
+        void getPolyline(juce::Range<double> timeRange, juce::Rectangle<float> area, int numColumns,
+                         juce::Array<juce::Point<float>>& polyline) const;
+
+        /**
+         * Draw a time range as a lane with the automation curve, and its breakpoints when they're sparse enough to see
+         * @param g Graphics context
+         * @param bounds Thumbnail bounds
+         * @param color Curve color
+         * @param timeRange Time to show
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                  juce::Range<double> timeRange) const;
+
+        /** Draw from the first breakpoint to the last */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const;
+
+    private:
+        struct Chunk
+        {
+            juce::Array<Breakpoint> points;
+            Breakpoint lowest, highest;
+
+            void updateExtremes();
+        };
+
+        /** The chunk and offset of a breakpoint index */
+        std::pair<int, int> locate(int index) const;
+
+        /** The chunk and offset of the first breakpoint at or after a time, or after it if afterEqual */
+        std::pair<int, int> locateTime(double time, bool afterEqual) const;
+
+        int getIndex(std::pair<int, int> position) const;
+
+        juce::Array<Chunk> chunks;
+        int numBreakpoints = 0;
+    };
+
+    // ============================================================================
+    // NUMBERED MODULES
+    // ============================================================================
+
+    /**
+     * The module glyphs of drawOsc1, drawFilter1, drawEnv1 and drawLFO1 without
+     * their labels. Each draws in the top 60% of the bounds, leaving the rest
+     * for the label.
+     */
+    static void drawOscillatorBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawFilterBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawEnvelopeBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+    static void drawLFOBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color);
+
+    /**
+     * Short labels in a bold font, rasterised once side by side into one alpha
+     * mask and drawn tinted with the current color. getNumerals() holds the
+     * digits 0 to 9, so any number is composed from ten cached glyphs.
+     */
+    class GlyphStrip
+    {
+    public:
+        /**
+         * Rasterise the labels
+         * @param labels One glyph per label; a label may be a whole word, keeping its kerning
+         * @param fontHeight Font height in logical pixels
+         * @param physicalPixelScale Display scale the strip is rendered at
+         */
+        GlyphStrip(const juce::StringArray& labels, float fontHeight, float physicalPixelScale = 1.0f);
+
+        /**
+         * Fetch (rasterising if needed) a shared strip; the most recently used 32 are kept
+         * @param labels Labels to rasterise
+         * @param fontHeight Font height in logical pixels
+         * @param physicalPixelScale Display scale
+         */
+        static std::shared_ptr<const GlyphStrip> getCached(const juce::StringArray& labels, float fontHeight,
+                                                           float physicalPixelScale = 1.0f);
+
+        /** The shared strip of the digits 0 to 9, indexed by digit */
+        static std::shared_ptr<const GlyphStrip> getNumerals(float fontHeight, float physicalPixelScale = 1.0f);
+
+        int getNumGlyphs() const noexcept { return glyphs.size(); }
+
+        /** Horizontal advance of a glyph in logical pixels */
+        float getAdvance(int index) const noexcept { return advances[index]; }
+
+        /** Bytes held by the strip */
+        size_t getMemoryUsage() const noexcept;
+
+        /**
+         * Draw one glyph with the current color
+         * @param g Graphics context
+         * @param index Glyph index
+         * @param position Top-left of the text line; snapped to whole physical pixels
+         */
+        void draw(juce::Graphics& g, int index, juce::Point<float> position) const;
+
+    private:
+        juce::Image strip;
+        juce::Array<juce::Image> glyphs;
+        juce::Array<float> advances;
+        float padding;
+        float scale;
+    };
+
+    /**
+     * A numbered synth module icon for any index, e.g. OscN in an 8-oscillator
+     * synth. The module glyph is rasterised once per size and scale as an alpha
+     * mask. The label is composed from a cached prefix glyph and the numeral strip.
+     * Osc 1, Filter 1, Envelope 1 and LFO 1 look as drawOsc1, drawFilter1,
+     * drawEnv1 and drawLFO1 do, up to kerning between the prefix and the digits.
+     * A translucent color draws the glyph live, since tinting the mask would
+     * also scale the tones a glyph sets with an absolute alpha.
+     */
+    class NumberedIcon
+    {
+    public:
+        /**
+         * @param base Single-tone glyph leaving the bottom 40% of the bounds for the label, e.g. drawOscillatorBase
+         * @param prefix Label text before the number, may be empty
+         * @param fontRatio Label font height as a proportion of the label row
+         */
+        NumberedIcon(DrawFunction base, const juce::String& prefix, float fontRatio);
+
+        static NumberedIcon oscillator() { return { &drawOscillatorBase, {}, 0.8f }; }
+        static NumberedIcon filter()     { return { &drawFilterBase, "F", 0.8f }; }
+        static NumberedIcon envelope()   { return { &drawEnvelopeBase, "ENV", 0.6f }; }
+        static NumberedIcon lfo()        { return { &drawLFOBase, "LFO", 0.6f }; }
+
+        /**
+         * Draw the cached glyph with its numbered label
+         * @param g Graphics context
+         * @param bounds Icon bounds
+         * @param color Icon color
+         * @param number Module number, 0 or more
+         */
+        void draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, int number);
+
+        /** Bytes held by the rasters this icon currently shares */
+        size_t getMemoryUsage() const noexcept;
+
+    private:
+        DrawFunction base;
+        juce::String prefix;
+        float fontRatio;
+
+        // Only refetched from the shared caches when size or scale change
+        std::shared_ptr<const juce::Image> baseMask;
+        std::shared_ptr<const GlyphStrip> prefixGlyph, numerals;
+        juce::Point<float> size;
+        float scale = 0.0f;
+    };
 };
@@ -330,6 +330,12 @@ void FancyIconPack::drawLearnMode(juce::Graphics& g, juce::Rectangle<float> boun
 }
 
 void FancyIconPack::drawVisualModulation(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawVisualModulation(g, bounds, color, 0.0f);
+}
+
+void FancyIconPack::drawVisualModulation(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                         float phase)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -344,7 +350,8 @@ void FancyIconPack::drawVisualModulation(juce::Graphics& g, juce::Rectangle<floa
     g.fillEllipse(centerX - controlRadius, centerY - controlRadius, controlRadius * 2, controlRadius * 2);
 
     // Control value indicator
-    auto valueAngle = juce::MathConstants<float>::pi * 0.25f; // Current value position
+    auto valueAngle = juce::MathConstants<float>::pi * 0.25f // Current value position, swept by the modulation
+                    + std::sin(phase * juce::MathConstants<float>::twoPi) * juce::MathConstants<float>::pi * 0.25f;
     auto valueLength = controlRadius * 0.7f;
     auto valueEnd = juce::Point<float>(centerX + std::cos(valueAngle) * valueLength,
                                       centerY + std::sin(valueAngle) * valueLength);
@@ -370,10 +377,11 @@ void FancyIconPack::drawVisualModulation(juce::Graphics& g, juce::Rectangle<floa
 
             // Ring segments showing modulation activity
             auto segmentCount = 8;
+            auto rotation = phase * juce::MathConstants<float>::twoPi * (i % 2 == 0 ? 1.0f : -1.0f); // Rings counter-rotate
             for (int seg = 0; seg < segmentCount; ++seg)
             {
-                auto startAngle = (seg / static_cast<float>(segmentCount)) * juce::MathConstants<float>::twoPi;
-                auto endAngle = ((seg + 0.7f) / static_cast<float>(segmentCount)) * juce::MathConstants<float>::twoPi;
+                auto startAngle = (seg / static_cast<float>(segmentCount)) * juce::MathConstants<float>::twoPi + rotation;
+                auto endAngle = ((seg + 0.7f) / static_cast<float>(segmentCount)) * juce::MathConstants<float>::twoPi + rotation;
 
                 // Modulation activity - some segments more active
                 auto activity = (seg % 3 == 0) ? 1.0f : (seg % 2 == 0) ? 0.6f : 0.3f;
@@ -445,6 +453,11 @@ void FancyIconPack::drawVisualModulation(juce::Graphics& g, juce::Rectangle<floa
 }
 
 void FancyIconPack::drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawAnimatedKnob(g, bounds, color, 0.0f);
+}
+
+void FancyIconPack::drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float phase)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -460,7 +473,7 @@ void FancyIconPack::drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> b
 
     // Animation trail - multiple pointer positions showing motion
     auto pointerLength = knobRadius * 0.7f;
-    auto currentAngle = juce::MathConstants<float>::pi * 0.3f; // Current position
+    auto currentAngle = juce::MathConstants<float>::pi * 0.3f + phase * juce::MathConstants<float>::twoPi; // Current position
     auto trailPositions = 5;
 
     for (int i = 0; i < trailPositions; ++i)
@@ -507,7 +520,7 @@ void FancyIconPack::drawAnimatedKnob(juce::Graphics& g, juce::Rectangle<float> b
         auto dotY = centerY + std::sin(dotAngle) * speedIndicatorRadius;
 
         // Dots brighter in direction of motion
-        auto angleDiff = std::abs(dotAngle - currentAngle);
+        auto angleDiff = std::fmod(std::abs(dotAngle - currentAngle), juce::MathConstants<float>::twoPi);
         if (angleDiff > juce::MathConstants<float>::pi) angleDiff = juce::MathConstants<float>::twoPi - angleDiff;
         auto brightness = 1.0f - (angleDiff / juce::MathConstants<float>::pi);
 
@@ -0,0 +1,267 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// COMPLEXITY ANALYSIS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    struct ComplexityField
+    {
+        const char* name;
+        int FancyIconPack::Complexity::* member;
+    };
+
+    const ComplexityField complexityFields[] =
+    {
+        { "subPaths",      &FancyIconPack::Complexity::subPaths },
+        { "lineSegments",  &FancyIconPack::Complexity::lineSegments },
+        { "curveSegments", &FancyIconPack::Complexity::curveSegments },
+        { "strokeOps",     &FancyIconPack::Complexity::strokeOps },
+        { "fillOps",       &FancyIconPack::Complexity::fillOps },
+        { "textOps",       &FancyIconPack::Complexity::textOps },
+        { "stateChanges",  &FancyIconPack::Complexity::stateChanges }
+    };
+
+    const ComplexityField* findField(const juce::String& name)
+    {
+        for (auto& field : complexityFields)
+            if (name == field.name)
+                return &field;
+
+        return nullptr;
+    }
+
+    bool findIcon(const juce::String& name, FancyIconPack::IconId& result)
+    {
+        for (int i = 0; i < FancyIconPack::numIcons; ++i)
+        {
+            auto icon = static_cast<FancyIconPack::IconId>(i);
+
+            if (name == FancyIconPack::getIconName(icon))
+            {
+                result = icon;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void countPath(const juce::Path& path, FancyIconPack::Complexity& c)
+    {
+        for (juce::Path::Iterator it(path); it.next();)
+        {
+            switch (it.elementType)
+            {
+                case juce::Path::Iterator::startNewSubPath: ++c.subPaths;      break;
+                case juce::Path::Iterator::lineTo:          ++c.lineSegments;  break;
+                case juce::Path::Iterator::quadraticTo:
+                case juce::Path::Iterator::cubicTo:         ++c.curveSegments; break;
+                default: break;
+            }
+        }
+    }
+
+    // A whole number, optionally negative for "no limit"
+    bool isValidLimit(const juce::String& text)
+    {
+        auto digits = text.startsWithChar('-') ? text.substring(1) : text;
+        return digits.isNotEmpty() && digits.containsOnly("0123456789");
+    }
+
+    int getTotalSegments(const FancyIconPack::Complexity& c) noexcept
+    {
+        return c.lineSegments + c.curveSegments;
+    }
+}
+
+FancyIconPack::Complexity FancyIconPack::Complexity::unlimited() noexcept
+{
+    Complexity c;
+
+    for (auto& field : complexityFields)
+        c.*(field.member) = -1;
+
+    return c;
+}
+
+juce::StringArray FancyIconPack::Complexity::getViolations(const Complexity& budget) const
+{
+    juce::StringArray violations;
+
+    for (auto& field : complexityFields)
+    {
+        auto limit = budget.*(field.member);
+        auto value = this->*(field.member);
+
+        if (limit >= 0 && value > limit)
+            violations.add(juce::String(field.name) + " " + juce::String(value) + " > " + juce::String(limit));
+    }
+
+    return violations;
+}
+
+FancyIconPack::Complexity FancyIconPack::analyseIcon(IconId icon, float size)
+{
+    auto geometry = recordIcon(icon, { size, size }, juce::Colours::white);
+
+    Complexity c;
+    c.stateChanges = geometry.numStateChanges;
+
+    for (auto& op : geometry.ops)
+    {
+        switch (op.type)
+        {
+            case IconGeometry::Op::Type::path:
+                countPath(op.path, c);
+                ++(op.isStroke ? c.strokeOps : c.fillOps);
+                break;
+
+            case IconGeometry::Op::Type::rectangle:
+                ++c.subPaths;
+                c.lineSegments += 4;
+                ++(op.isStroke ? c.strokeOps : c.fillOps);
+                break;
+
+            case IconGeometry::Op::Type::glyph:
+                ++c.textOps;
+                break;
+        }
+    }
+
+    return c;
+}
+
+juce::String FancyIconPack::createComplexityReport(float size)
+{
+    struct Row
+    {
+        IconId icon;
+        Complexity complexity;
+    };
+
+    juce::Array<Row> rows;
+
+    for (int i = 0; i < numIcons; ++i)
+    {
+        auto icon = static_cast<IconId>(i);
+
+        if (isIconSelected(icon))
+            rows.add({ icon, analyseIcon(icon, size) });
+    }
+
+    std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b)
+    {
+        return getTotalSegments(a.complexity) > getTotalSegments(b.complexity);
+    });
+
+    juce::String report;
+    report << juce::String("Icon").paddedRight(' ', 24);
+
+    for (auto& field : complexityFields)
+        report << juce::String(field.name).paddedLeft(' ', 15);
+
+    report << "\n";
+
+    for (auto& row : rows)
+    {
+        report << juce::String(getIconName(row.icon)).paddedRight(' ', 24);
+
+        for (auto& field : complexityFields)
+            report << juce::String(row.complexity.*(field.member)).paddedLeft(' ', 15);
+
+        report << "\n";
+    }
+
+    return report;
+}
+
+juce::StringArray FancyIconPack::checkComplexityBudgets(const juce::String& budgetSpec, float size)
+{
+    juce::StringArray errors;
+
+    // Per-icon rules only override the fields they name; everything else comes
+    // from the '*' rule, wherever it appears in the spec
+    auto defaultBudget = Complexity::unlimited();
+    juce::Array<Complexity> overrides;
+    juce::Array<int> overriddenFields;   // one bit per complexityFields entry, so an override of -1 still counts
+
+    for (int i = 0; i < numIcons; ++i)
+    {
+        overrides.add(Complexity::unlimited());
+        overriddenFields.add(0);
+    }
+
+    auto lineNumber = 0;
+
+    for (auto& rawLine : juce::StringArray::fromLines(budgetSpec))
+    {
+        ++lineNumber;
+        auto line = rawLine.upToFirstOccurrenceOf("#", false, false).trim();
+
+        if (line.isEmpty())
+            continue;
+
+        auto tokens = juce::StringArray::fromTokens(line, " \t", "");
+        tokens.removeEmptyStrings();
+
+        auto target = tokens[0];
+        auto isDefault = target == "*";
+        IconId icon {};
+
+        if (! isDefault && ! findIcon(target, icon))
+        {
+            errors.add("line " + juce::String(lineNumber) + ": unknown icon '" + target + "'");
+            continue;
+        }
+
+        for (int t = 1; t < tokens.size(); ++t)
+        {
+            auto name = tokens[t].upToFirstOccurrenceOf("=", false, false);
+            auto* field = findField(name);
+
+            auto value = tokens[t].fromFirstOccurrenceOf("=", false, false);
+
+            if (field == nullptr || ! tokens[t].containsChar('=') || ! isValidLimit(value))
+            {
+                errors.add("line " + juce::String(lineNumber) + ": bad budget '" + tokens[t] + "'");
+                continue;
+            }
+
+            auto limit = value.getIntValue();
+
+            if (isDefault)
+            {
+                defaultBudget.*(field->member) = limit;
+            }
+            else
+            {
+                overrides.getReference((int) icon).*(field->member) = limit;
+                overriddenFields.getReference((int) icon) |= 1 << (int) (field - complexityFields);
+            }
+        }
+    }
+
+    for (int i = 0; i < numIcons; ++i)
+    {
+        auto icon = static_cast<IconId>(i);
+        auto budget = defaultBudget;
+
+        if (! isIconSelected(icon))
+            continue;
+
+        for (int f = 0; f < (int) juce::numElementsInArray(complexityFields); ++f)
+        {
+            auto member = complexityFields[f].member;
+
+            if ((overriddenFields[i] & (1 << f)) != 0)
+                budget.*member = overrides.getReference(i).*member;
+        }
+
+        for (auto& violation : analyseIcon(icon, size).getViolations(budget))
+            errors.add(juce::String(getIconName(icon)) + ": " + violation);
+    }
+
+    return errors;
+}
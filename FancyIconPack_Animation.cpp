@@ -0,0 +1,267 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// ANIMATION IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr size_t maxCachedStrips = 32;
+
+    float wrapPhase(float phase) noexcept
+    {
+        return phase - std::floor(phase);
+    }
+
+    float getClockPhase(double elapsedSeconds, double periodSeconds, int numFrames) noexcept
+    {
+        auto phase = wrapPhase((float) std::fmod(elapsedSeconds / periodSeconds, 1.0));
+
+        // Stepped animations only move, and so only repaint, on a new frame
+        if (numFrames > 0)
+            phase = std::floor(phase * numFrames) / numFrames;
+
+        return phase;
+    }
+
+    struct StripKey
+    {
+        FancyIconPack::AnimatedDrawFunction draw;
+        int width, height, scale, numFrames;
+        juce::uint32 argb;
+
+        bool operator==(const StripKey& other) const noexcept
+        {
+            return draw == other.draw && width == other.width && height == other.height
+                && scale == other.scale && numFrames == other.numFrames && argb == other.argb;
+        }
+    };
+
+    struct StripCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<StripKey, std::shared_ptr<const FancyIconPack::AnimationStrip>>> entries;
+    };
+}
+
+// ============================================================================
+// AnimationStrip
+// ============================================================================
+
+FancyIconPack::AnimationStrip::AnimationStrip(AnimatedDrawFunction draw, juce::Point<float> size, juce::Colour color,
+                                              int numFrames, float physicalPixelScale)
+    : scale(physicalPixelScale)
+{
+    jassert(draw != nullptr && numFrames > 0);
+
+    numFrames = juce::jmax(1, numFrames);
+    auto frameWidth = juce::jmax(1, (int) std::ceil(size.x * scale));
+    auto frameHeight = juce::jmax(1, (int) std::ceil(size.y * scale));
+
+    strip = juce::Image(juce::Image::ARGB, frameWidth * numFrames, frameHeight, true);
+
+    {
+        juce::Graphics g(strip);
+
+        for (int i = 0; i < numFrames; ++i)
+        {
+            juce::Graphics::ScopedSaveState state(g);
+            g.reduceClipRegion(i * frameWidth, 0, frameWidth, frameHeight);
+            g.addTransform(juce::AffineTransform::scale(scale).translated((float) (i * frameWidth), 0.0f));
+            draw(g, { 0.0f, 0.0f, size.x, size.y }, color, i / static_cast<float>(numFrames));
+        }
+    }
+
+    // Frames share the strip's pixels
+    for (int i = 0; i < numFrames; ++i)
+        frames.add(strip.getClippedImage({ i * frameWidth, 0, frameWidth, frameHeight }));
+}
+
+std::shared_ptr<const FancyIconPack::AnimationStrip>
+FancyIconPack::AnimationStrip::getCached(AnimatedDrawFunction draw, juce::Point<float> size, juce::Colour color,
+                                         int numFrames, float physicalPixelScale)
+{
+    static StripCache cache;
+
+    StripKey key { draw,
+                   juce::roundToInt(size.x * 64.0f),
+                   juce::roundToInt(size.y * 64.0f),
+                   juce::roundToInt(physicalPixelScale * 64.0f),
+                   numFrames,
+                   color.getARGB() };
+
+    const juce::ScopedLock sl(cache.lock);
+
+    for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+    {
+        if (it->first == key)
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+            return it->second;
+        }
+    }
+
+    auto strip = std::make_shared<const AnimationStrip>(draw, size, color, numFrames, physicalPixelScale);
+    cache.entries.emplace_front(key, strip);
+
+    if (cache.entries.size() > maxCachedStrips)
+        cache.entries.pop_back();
+
+    return strip;
+}
+
+int FancyIconPack::AnimationStrip::getFrameIndex(float phase) const noexcept
+{
+    return juce::jmin(frames.size() - 1, (int) (wrapPhase(phase) * frames.size()));
+}
+
+size_t FancyIconPack::AnimationStrip::getMemoryUsage() const noexcept
+{
+    return (size_t) strip.getWidth() * (size_t) strip.getHeight() * 4;
+}
+
+void FancyIconPack::AnimationStrip::draw(juce::Graphics& g, juce::Point<float> origin, float phase) const
+{
+    // Whole physical pixels, so the frame isn't resampled at fractional origins
+    auto snapped = (origin * scale).roundToInt().toFloat() / scale;
+    g.drawImageTransformed(frames.getReference(getFrameIndex(phase)),
+                           juce::AffineTransform::scale(1.0f / scale).translated(snapped));
+}
+
+// ============================================================================
+// AnimationClock
+// ============================================================================
+
+FancyIconPack::AnimationClock::AnimationClock(juce::Component& host)
+    : now(juce::Time::getMillisecondCounterHiRes() * 0.001),
+      vblank(&host, [this] { tick(juce::Time::getMillisecondCounterHiRes() * 0.001); })
+{
+}
+
+FancyIconPack::AnimationClock::Animation* FancyIconPack::AnimationClock::find(int animationId) noexcept
+{
+    for (auto& animation : animations)
+        if (animation.id == animationId)
+            return &animation;
+
+    return nullptr;
+}
+
+const FancyIconPack::AnimationClock::Animation* FancyIconPack::AnimationClock::find(int animationId) const noexcept
+{
+    return const_cast<AnimationClock*>(this)->find(animationId);
+}
+
+int FancyIconPack::AnimationClock::add(juce::Component& owner, juce::Rectangle<float> bounds, double periodSeconds,
+                                       int numFrames)
+{
+    jassert(periodSeconds > 0.0 && numFrames >= 0);
+
+    // Every animation counts from time zero, so equal periods stay in step
+    Animation animation { nextId++, &owner, bounds, juce::jmax(1.0e-3, periodSeconds), 0.0, numFrames };
+    animation.phase = getClockPhase(now, animation.periodSeconds, numFrames);
+    animations.add(animation);
+
+    return animation.id;
+}
+
+void FancyIconPack::AnimationClock::remove(int animationId)
+{
+    animations.removeIf([animationId](const Animation& animation) { return animation.id == animationId; });
+}
+
+void FancyIconPack::AnimationClock::setBounds(int animationId, juce::Rectangle<float> bounds)
+{
+    if (auto* animation = find(animationId))
+        animation->bounds = bounds;
+}
+
+void FancyIconPack::AnimationClock::setRunning(int animationId, bool shouldRun)
+{
+    auto* animation = find(animationId);
+
+    if (animation == nullptr || animation->running == shouldRun)
+        return;
+
+    // Resume from the held phase rather than jumping to where the clock is now
+    if (shouldRun)
+        animation->startSeconds = now - animation->phase * animation->periodSeconds;
+
+    animation->running = shouldRun;
+}
+
+float FancyIconPack::AnimationClock::getPhase(int animationId) const
+{
+    auto* animation = find(animationId);
+    return animation != nullptr ? animation->phase : 0.0f;
+}
+
+juce::RectangleList<int> FancyIconPack::AnimationClock::getDirtyRegion(const juce::Component& owner) const
+{
+    for (auto& dirty : dirtyRegions)
+        if (dirty.owner == &owner)
+            return dirty.region;
+
+    return {};
+}
+
+void FancyIconPack::AnimationClock::tick(double timeSeconds)
+{
+    now = timeSeconds;
+    dirtyRegions.clearQuick();
+
+    for (int i = animations.size(); --i >= 0;)
+    {
+        auto& animation = animations.getReference(i);
+
+        if (animation.owner == nullptr)
+        {
+            animations.remove(i);
+            continue;
+        }
+
+        if (! animation.running)
+            continue;
+
+        auto phase = getClockPhase(now - animation.startSeconds, animation.periodSeconds, animation.numFrames);
+
+        if (phase == animation.phase)
+            continue;
+
+        animation.phase = phase;
+
+        auto* owner = animation.owner.getComponent();
+        auto area = animation.bounds.getSmallestIntegerContainer();
+        auto* dirty = std::find_if(dirtyRegions.begin(), dirtyRegions.end(),
+                                   [owner](const DirtyRegion& d) { return d.owner == owner; });
+
+        if (dirty != dirtyRegions.end())
+            dirty->region.add(area);
+        else
+            dirtyRegions.add({ owner, juce::RectangleList<int>(area) });
+    }
+
+    for (auto& dirty : dirtyRegions)
+        for (auto area : dirty.region)
+            dirty.owner->repaint(area);
+}
+
+// ============================================================================
+// Animated icon drawing
+// ============================================================================
+
+void FancyIconPack::drawAnimated(juce::Graphics& g, AnimatedDrawFunction draw, juce::Rectangle<float> bounds,
+                                 juce::Colour color, float phase, int numFrames)
+{
+    if (numFrames <= 0)
+    {
+        draw(g, bounds, color, wrapPhase(phase));
+        return;
+    }
+
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    AnimationStrip::getCached(draw, { bounds.getWidth(), bounds.getHeight() }, color, numFrames, scale)
+        ->draw(g, bounds.getPosition(), phase);
+}
@@ -199,23 +199,11 @@ void FancyIconPack::drawMeter(juce::Graphics& g, juce::Rectangle<float> bounds,
     g.drawRoundedRectangle(iconBounds, 2.0f, stroke);
 
     // Meter bars (level indicators)
-    auto barCount = 5;
-    auto barSpacing = iconBounds.getWidth() / (barCount + 1);
-    auto barWidth = barSpacing * 0.6f;
-
-    for (int i = 0; i < barCount; ++i)
+    for (int i = 0; i < numMeterBars; ++i)
     {
-        auto x = iconBounds.getX() + (i + 0.7f) * barSpacing;
-        auto barHeight = iconBounds.getHeight() * (0.2f + (i + 1) * 0.12f); // Graduated heights
-        auto y = iconBounds.getBottom() - barHeight - iconBounds.getHeight() * 0.1f;
-
-        // Color coding: green -> yellow -> red
         auto alpha = (i < 3) ? 1.0f : 0.7f;
-        auto barColor = (i < 2) ? color.withAlpha(alpha) :
-                       (i < 4) ? color.withHue(0.15f).withAlpha(alpha) : color.withHue(0.0f).withAlpha(alpha);
-
-        g.setColour(barColor);
-        g.fillRoundedRectangle(x, y, barWidth, barHeight, 1.0f);
+        g.setColour(getMeterBarColor(color, i).withAlpha(alpha));
+        g.fillRoundedRectangle(getMeterBarBounds(iconBounds, i), 1.0f);
     }
 
     // Needle or indicator line
@@ -382,8 +370,8 @@ void FancyIconPack::drawSineWave(juce::Graphics& g, juce::Rectangle<float> bound
     for (int i = 1; i <= points; ++i)
     {
         auto x = iconBounds.getX() + (i / static_cast<float>(points)) * iconBounds.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 2.0f;
-        auto amplitude = std::sin(phase) * iconBounds.getHeight() * 0.35f;
+        auto cycles = (i / static_cast<float>(points)) * 2.0f;
+        auto amplitude = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * iconBounds.getHeight() * 0.35f;
         sineWave.lineTo(x, waveY + amplitude);
     }
 
@@ -589,8 +577,8 @@ void FancyIconPack::drawInvertPhase(juce::Graphics& g, juce::Rectangle<float> bo
     for (int i = 1; i <= points; ++i)
     {
         auto x = iconBounds.getX() + (i / static_cast<float>(points)) * iconBounds.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
 
         originalWave.lineTo(x, waveY + amp);
         invertedWave.lineTo(x, waveY - amp); // Inverted
@@ -361,8 +361,8 @@ void FancyIconPack::drawLFO(juce::Graphics& g, juce::Rectangle<float> bounds, ju
     for (int i = 1; i <= points; ++i)
     {
         auto x = iconBounds.getX() + (i / static_cast<float>(points)) * iconBounds.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.0f; // One full cycle
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = i / static_cast<float>(points);
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         lfoWave.lineTo(x, waveY + amp);
     }
 
@@ -636,8 +636,8 @@ void FancyIconPack::drawDryWet(juce::Graphics& g, juce::Rectangle<float> bounds,
     for (int i = 1; i <= points; ++i)
     {
         auto x = dryBounds.getX() + (i / static_cast<float>(points)) * dryBounds.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * dryAmplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * dryAmplitude;
         dryWave.lineTo(x, dryY + amp);
     }
 
@@ -946,8 +946,8 @@ void FancyIconPack::drawSidechain(juce::Graphics& g, juce::Rectangle<float> boun
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 2.0f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 2.0f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         sideWave.lineTo(x, waveY + amp);
     }
 
@@ -1848,8 +1848,8 @@ void FancyIconPack::drawGranular(juce::Graphics& g, juce::Rectangle<float> bound
     for (int i = 1; i <= points; ++i)
     {
         auto x = sourceArea.getX() + (i / static_cast<float>(points)) * sourceArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * sourceAmplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * sourceAmplitude;
         sourceWave.lineTo(x, sourceY + amp);
     }
 
@@ -1930,6 +1930,11 @@ void FancyIconPack::drawGranular(juce::Graphics& g, juce::Rectangle<float> bound
 }
 
 void FancyIconPack::drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawFreeze(g, bounds, color, 0.0f);
+}
+
+void FancyIconPack::drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float phase)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -1950,8 +1955,8 @@ void FancyIconPack::drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds,
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         frozenWave.lineTo(x, waveY + amp);
     }
 
@@ -1991,6 +1996,12 @@ void FancyIconPack::drawFreeze(juce::Graphics& g, juce::Rectangle<float> bounds,
         auto snowY = iconBounds.getY() + iconBounds.getHeight() * 0.15f;
         auto snowSize = stroke * 2;
 
+        // Each flake turns half a revolution per loop, which maps it back onto itself
+        juce::Graphics::ScopedSaveState state(g);
+
+        if (phase != 0.0f)
+            g.addTransform(juce::AffineTransform::rotation(phase * juce::MathConstants<float>::pi, snowX, snowY));
+
         // Simple snowflake (6-pointed star)
         g.setColour(color.withAlpha(0.6f));
 
@@ -2059,8 +2070,8 @@ void FancyIconPack::drawStereo(juce::Graphics& g, juce::Rectangle<float> bounds,
     for (int i = 1; i <= points; ++i)
     {
         auto x = leftArea.getX() + (i / static_cast<float>(points)) * leftArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * leftAmplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * leftAmplitude;
         leftWave.lineTo(x, leftY + amp);
     }
 
@@ -2114,8 +2125,8 @@ void FancyIconPack::drawMono(juce::Graphics& g, juce::Rectangle<float> bounds, j
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         monoWave.lineTo(x, waveY + amp);
     }
 
@@ -0,0 +1,397 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// AUTOMATION THUMBNAIL IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    using Breakpoint = FancyIconPack::AutomationThumbnail::Breakpoint;
+
+    // Full chunks split in half, so an edit never shifts more than this many points
+    constexpr int maxChunkSize = 128;
+
+    bool isSamePoint(const Breakpoint& a, const Breakpoint& b) noexcept
+    {
+        return a.time == b.time && a.value == b.value;
+    }
+}
+
+// ============================================================================
+// Chunks
+// ============================================================================
+
+void FancyIconPack::AutomationThumbnail::Chunk::updateExtremes()
+{
+    lowest = highest = points.getFirst();
+
+    for (auto& point : points)
+    {
+        if (point.value < lowest.value)
+            lowest = point;
+
+        if (point.value > highest.value)
+            highest = point;
+    }
+}
+
+std::pair<int, int> FancyIconPack::AutomationThumbnail::locate(int index) const
+{
+    jassert(juce::isPositiveAndBelow(index, numBreakpoints));
+
+    for (int c = 0; c < chunks.size(); ++c)
+    {
+        auto size = chunks.getReference(c).points.size();
+
+        if (index < size)
+            return { c, index };
+
+        index -= size;
+    }
+
+    return { chunks.size(), 0 };
+}
+
+std::pair<int, int> FancyIconPack::AutomationThumbnail::locateTime(double time, bool afterEqual) const
+{
+    auto isBefore = [time, afterEqual](const Breakpoint& point)
+    {
+        return afterEqual ? point.time <= time : point.time < time;
+    };
+
+    // The first chunk that doesn't end before the time
+    auto low = 0, high = chunks.size();
+
+    while (low < high)
+    {
+        auto mid = (low + high) / 2;
+
+        if (isBefore(chunks.getReference(mid).points.getLast()))
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    if (low == chunks.size())
+        return { low, 0 };
+
+    auto& points = chunks.getReference(low).points;
+    auto offset = 0;
+
+    for (high = points.size(); offset < high;)
+    {
+        auto mid = (offset + high) / 2;
+
+        if (isBefore(points.getReference(mid)))
+            offset = mid + 1;
+        else
+            high = mid;
+    }
+
+    return { low, offset };
+}
+
+int FancyIconPack::AutomationThumbnail::getIndex(std::pair<int, int> position) const
+{
+    auto index = position.second;
+
+    for (int c = 0; c < position.first; ++c)
+        index += chunks.getReference(c).points.size();
+
+    return index;
+}
+
+// ============================================================================
+// Editing
+// ============================================================================
+
+void FancyIconPack::AutomationThumbnail::setBreakpoints(const Breakpoint* points, int numPoints)
+{
+    clear();
+
+    for (int start = 0; start < numPoints; start += maxChunkSize / 2)
+    {
+        Chunk chunk;
+        chunk.points.addArray(points + start, juce::jmin(maxChunkSize / 2, numPoints - start));
+        chunk.updateExtremes();
+        chunks.add(std::move(chunk));
+    }
+
+    numBreakpoints = juce::jmax(0, numPoints);
+
+    jassert(std::is_sorted(points, points + numBreakpoints,
+                           [](const Breakpoint& a, const Breakpoint& b) { return a.time < b.time; }));
+}
+
+int FancyIconPack::AutomationThumbnail::addBreakpoint(double time, float value)
+{
+    if (chunks.isEmpty())
+        chunks.add({});
+
+    auto position = numBreakpoints > 0 ? locateTime(time, true) : std::make_pair(0, 0);
+
+    if (position.first == chunks.size())
+        position = { chunks.size() - 1, chunks.getReference(chunks.size() - 1).points.size() };
+
+    auto index = getIndex(position);
+    auto& chunk = chunks.getReference(position.first);
+    chunk.points.insert(position.second, { time, value });
+    ++numBreakpoints;
+
+    if (chunk.points.size() > maxChunkSize)
+    {
+        Chunk upper;
+        upper.points.addArray(chunk.points, maxChunkSize / 2);
+        chunk.points.removeRange(maxChunkSize / 2, chunk.points.size());
+        chunk.updateExtremes();
+        upper.updateExtremes();
+        chunks.insert(position.first + 1, std::move(upper));
+    }
+    else
+    {
+        chunk.updateExtremes();
+    }
+
+    return index;
+}
+
+void FancyIconPack::AutomationThumbnail::removeBreakpoint(int index)
+{
+    if (! juce::isPositiveAndBelow(index, numBreakpoints))
+    {
+        jassertfalse;
+        return;
+    }
+
+    auto position = locate(index);
+    auto& chunk = chunks.getReference(position.first);
+    chunk.points.remove(position.second);
+    --numBreakpoints;
+
+    if (chunk.points.isEmpty())
+        chunks.remove(position.first);
+    else
+        chunk.updateExtremes();
+}
+
+int FancyIconPack::AutomationThumbnail::moveBreakpoint(int index, double newTime, float newValue)
+{
+    removeBreakpoint(index);
+    return addBreakpoint(newTime, newValue);
+}
+
+void FancyIconPack::AutomationThumbnail::clear()
+{
+    chunks.clear();
+    numBreakpoints = 0;
+}
+
+FancyIconPack::AutomationThumbnail::Breakpoint FancyIconPack::AutomationThumbnail::getBreakpoint(int index) const
+{
+    if (! juce::isPositiveAndBelow(index, numBreakpoints))
+    {
+        jassertfalse;
+        return { 0.0, 0.0f };
+    }
+
+    auto position = locate(index);
+    return chunks.getReference(position.first).points.getReference(position.second);
+}
+
+juce::Range<int> FancyIconPack::AutomationThumbnail::getVisibleRange(juce::Range<double> timeRange) const
+{
+    return { getIndex(locateTime(timeRange.getStart(), false)), getIndex(locateTime(timeRange.getEnd(), true)) };
+}
+
+// ============================================================================
+// Decimation and drawing
+// ============================================================================
+
+void FancyIconPack::AutomationThumbnail::getPolyline(juce::Range<double> timeRange, juce::Rectangle<float> area,
+                                                     int numColumns, juce::Array<juce::Point<float>>& polyline) const
+{
+    polyline.clearQuick();
+
+    if (numBreakpoints == 0 || timeRange.getLength() <= 0.0)
+        return;
+
+    numColumns = juce::jmax(1, numColumns);
+    auto start = timeRange.getStart();
+    auto length = timeRange.getLength();
+    const Breakpoint* previous = nullptr;
+
+    auto emit = [&](const Breakpoint& point)
+    {
+        if (previous != nullptr && isSamePoint(*previous, point))
+            return;
+
+        previous = &point;
+        polyline.add({ area.getX() + (float) ((point.time - start) / length) * area.getWidth(),
+                       area.getBottom() - juce::jlimit(0.0f, 1.0f, point.value) * area.getHeight() });
+    };
+
+    auto position = locateTime(start, false);
+
+    // The breakpoint before the range, so the curve enters from the left edge
+    if (position.second > 0)
+        emit(chunks.getReference(position.first).points.getReference(position.second - 1));
+    else if (position.first > 0)
+    {
+        auto& before = chunks.getReference(position.first - 1).points;
+        emit(before.getReference(before.size() - 1));
+    }
+
+    for (int column = 0; column < numColumns; ++column)
+    {
+        auto columnEnd = start + length * (column + 1) / numColumns;
+        auto isLastColumn = column == numColumns - 1;
+        auto inColumn = [&](double time) { return time < columnEnd || (isLastColumn && time <= timeRange.getEnd()); };
+
+        const Breakpoint* first = nullptr;
+        const Breakpoint* last = nullptr;
+        const Breakpoint* lowest = nullptr;
+        const Breakpoint* highest = nullptr;
+
+        auto include = [&](const Breakpoint& begin, const Breakpoint& end, const Breakpoint& low, const Breakpoint& high)
+        {
+            if (first == nullptr)
+            {
+                first = &begin;
+                lowest = &low;
+                highest = &high;
+            }
+
+            last = &end;
+
+            if (low.value < lowest->value)
+                lowest = &low;
+
+            if (high.value > highest->value)
+                highest = &high;
+        };
+
+        while (position.first < chunks.size())
+        {
+            auto& chunk = chunks.getReference(position.first);
+
+            // A chunk wholly inside the column only contributes its ends and cached extremes
+            if (position.second == 0 && inColumn(chunk.points.getLast().time))
+            {
+                include(chunk.points.getReference(0), chunk.points.getReference(chunk.points.size() - 1),
+                        chunk.lowest, chunk.highest);
+                position = { position.first + 1, 0 };
+                continue;
+            }
+
+            auto& point = chunk.points.getReference(position.second);
+
+            if (! inColumn(point.time))
+                break;
+
+            include(point, point, point, point);
+
+            if (++position.second == chunk.points.size())
+                position = { position.first + 1, 0 };
+        }
+
+        if (first == nullptr)
+            continue;
+
+        emit(*first);
+
+        // Extremes in time order, so the line still passes through both peaks
+        if (lowest->time <= highest->time)
+        {
+            emit(*lowest);
+            emit(*highest);
+        }
+        else
+        {
+            emit(*highest);
+            emit(*lowest);
+        }
+
+        emit(*last);
+    }
+
+    // The breakpoint after the range, so the curve leaves through the right edge
+    if (position.first < chunks.size())
+        emit(chunks.getReference(position.first).points.getReference(position.second));
+
+    // Values hold before the first breakpoint and after the last
+    if (polyline.getFirst().x > area.getX())
+        polyline.insert(0, { area.getX(), polyline.getFirst().y });
+
+    if (polyline.getLast().x < area.getRight())
+        polyline.add({ area.getRight(), polyline.getLast().y });
+}
+
+void FancyIconPack::AutomationThumbnail::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                              juce::Range<double> timeRange) const
+{
+    auto stroke = getOptimalStrokeWidth(bounds);
+
+    // Lane background, as in drawAutomationLane
+    g.setColour(color.withAlpha(0.2f));
+    g.fillRoundedRectangle(bounds, 2.0f);
+
+    auto curveArea = bounds.reduced(stroke);
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto numColumns = juce::jmax(1, juce::roundToInt(curveArea.getWidth() * scale));
+
+    juce::Array<juce::Point<float>> polyline;
+    polyline.ensureStorageAllocated(numColumns * 4 + 4);
+    getPolyline(timeRange, curveArea, numColumns, polyline);
+
+    if (polyline.isEmpty())
+        return;
+
+    juce::Graphics::ScopedSaveState state(g);
+    g.reduceClipRegion(bounds.getSmallestIntegerContainer());
+
+    juce::Path curve;
+    curve.preallocateSpace(polyline.size() * 3);
+    curve.startNewSubPath(polyline.getFirst());
+
+    for (int i = 1; i < polyline.size(); ++i)
+        curve.lineTo(polyline.getReference(i));
+
+    g.setColour(color);
+    g.strokePath(curve, createStroke(stroke));
+
+    // Breakpoint dots only while there's room to tell them apart
+    auto visible = getVisibleRange(timeRange);
+    auto pointRadius = stroke * 1.2f;
+
+    if (visible.isEmpty() || (float) visible.getLength() * pointRadius * 4.0f > curveArea.getWidth())
+        return;
+
+    auto position = locate(visible.getStart());
+
+    for (int i = 0; i < visible.getLength(); ++i)
+    {
+        auto& chunk = chunks.getReference(position.first);
+        auto& point = chunk.points.getReference(position.second);
+        auto x = curveArea.getX() + (float) ((point.time - timeRange.getStart()) / timeRange.getLength()) * curveArea.getWidth();
+        auto y = curveArea.getBottom() - juce::jlimit(0.0f, 1.0f, point.value) * curveArea.getHeight();
+
+        g.fillEllipse(x - pointRadius, y - pointRadius, pointRadius * 2, pointRadius * 2);
+
+        if (++position.second == chunk.points.size())
+            position = { position.first + 1, 0 };
+    }
+}
+
+void FancyIconPack::AutomationThumbnail::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    if (numBreakpoints == 0)
+    {
+        draw(g, bounds, color, { 0.0, 1.0 });
+        return;
+    }
+
+    auto first = chunks.getFirst().points.getFirst().time;
+    auto last = chunks.getLast().points.getLast().time;
+
+    draw(g, bounds, color, last > first ? juce::Range<double>(first, last) : juce::Range<double>(first - 0.5, first + 0.5));
+}
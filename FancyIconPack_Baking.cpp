@@ -0,0 +1,506 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// BAKED ICON DATA IMPLEMENTATION
+// ============================================================================
+//
+// Blob layout (all values little-endian):
+//
+//   char[4]  magic "FIPB"
+//   uint16   format version
+//   uint16   number of icons (must match FancyIconPack::numIcons)
+//   uint16   number of baked sizes
+//   uint16   physical pixel scale the icons were recorded for, in 1/16
+//   uint32   probe colour the icons were recorded with
+//   uint16   baked sizes, in 1/16 px                    [numSizes]
+//   uint32   entry offsets from blob start, 0 = absent  [numIcons * numSizes]
+//   entries
+//
+// Each entry is a flags byte followed by an op stream terminated by opEnd.
+// Coordinates are int16 in units of 1/8192 of the baked size, relative to the
+// icon's top-left corner.
+
+namespace
+{
+    constexpr char bakedMagic[4] = { 'F', 'I', 'P', 'B' };
+    constexpr int bakedVersion = 2;
+    constexpr int headerSize = 16;
+    constexpr float coordinateScale = 8192.0f;
+    constexpr float sizeScale = 16.0f;
+
+    // Two probes with the same alpha but unrelated hues: an op that follows the
+    // base color changes between them, a literal color (e.g. Colours::white) doesn't
+    const juce::Colour probeA(0xd34a90d9);
+    const juce::Colour probeB(0xd3d9704a);
+
+    enum EntryFlags : juce::uint8
+    {
+        derivedColours  = 1 << 0,   // uses brighter()/withHue() etc., which can't be rebased
+        approximateText = 1 << 1    // glyphs stored as unhinted outlines
+    };
+
+    enum OpCode : juce::uint8
+    {
+        opEnd = 0,
+        opBaseColour,       // the caller's color, alpha included
+        opBaseAlpha,        // caller's RGB, +1 byte alpha
+        opLiteralColour,    // +4 bytes ARGB
+        opMoveTo,           // +2 coords
+        opLineTo,           // +2 coords
+        opQuadTo,           // +4 coords
+        opCubicTo,          // +6 coords
+        opClose,
+        opFillNonZero,      // fill and clear the current path
+        opFillEvenOdd,
+        opFillRect          // +4 coords: x, y, w, h
+    };
+
+    bool isSameRGB(juce::Colour a, juce::Colour b) noexcept
+    {
+        return (a.getARGB() & 0x00ffffff) == (b.getARGB() & 0x00ffffff);
+    }
+
+    class EntryWriter
+    {
+    public:
+        EntryWriter(juce::MemoryOutputStream& output, float bakedSize)
+            : out(output), scale(coordinateScale / bakedSize)
+        {
+        }
+
+        void writeColour(juce::Colour fromA, juce::Colour fromB, juce::uint8& flags)
+        {
+            if (fromA == probeA && fromB == probeB)
+            {
+                writeOpIfChanged(opBaseColour, 0);
+            }
+            else if (isSameRGB(fromA, probeA) && isSameRGB(fromB, probeB) && fromA.getAlpha() == fromB.getAlpha())
+            {
+                writeOpIfChanged(opBaseAlpha, fromA.getAlpha());
+            }
+            else
+            {
+                if (fromA != fromB)
+                    flags |= derivedColours;
+
+                writeOpIfChanged(opLiteralColour, fromA.getARGB());
+            }
+        }
+
+        void writePath(const juce::Path& path)
+        {
+            for (juce::Path::Iterator it(path); it.next();)
+            {
+                switch (it.elementType)
+                {
+                    case juce::Path::Iterator::startNewSubPath:
+                        out.writeByte((char) opMoveTo);
+                        writePoint(it.x1, it.y1);
+                        break;
+
+                    case juce::Path::Iterator::lineTo:
+                        out.writeByte((char) opLineTo);
+                        writePoint(it.x1, it.y1);
+                        break;
+
+                    case juce::Path::Iterator::quadraticTo:
+                        out.writeByte((char) opQuadTo);
+                        writePoint(it.x1, it.y1);
+                        writePoint(it.x2, it.y2);
+                        break;
+
+                    case juce::Path::Iterator::cubicTo:
+                        out.writeByte((char) opCubicTo);
+                        writePoint(it.x1, it.y1);
+                        writePoint(it.x2, it.y2);
+                        writePoint(it.x3, it.y3);
+                        break;
+
+                    case juce::Path::Iterator::closePath:
+                        out.writeByte((char) opClose);
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            out.writeByte((char) (path.isUsingNonZeroWinding() ? opFillNonZero : opFillEvenOdd));
+        }
+
+        void writeRectangle(juce::Rectangle<float> r)
+        {
+            out.writeByte((char) opFillRect);
+            writePoint(r.getX(), r.getY());
+            writePoint(r.getWidth(), r.getHeight());
+        }
+
+    private:
+        void writeOpIfChanged(OpCode op, juce::uint32 argument)
+        {
+            if (op == lastColourOp && argument == lastColourArgument)
+                return;
+
+            lastColourOp = op;
+            lastColourArgument = argument;
+            out.writeByte((char) op);
+
+            if (op == opBaseAlpha)
+                out.writeByte((char) argument);
+            else if (op == opLiteralColour)
+                out.writeInt((int) argument);
+        }
+
+        void writePoint(float x, float y)
+        {
+            out.writeShort(quantise(x));
+            out.writeShort(quantise(y));
+        }
+
+        short quantise(float v) const
+        {
+            return (short) juce::jlimit(-32768, 32767, juce::roundToInt(v * scale));
+        }
+
+        juce::MemoryOutputStream& out;
+        float scale;
+        OpCode lastColourOp = opEnd;
+        juce::uint32 lastColourArgument = 0;
+    };
+
+    bool isBakeable(const FancyIconPack::IconGeometry& a, const FancyIconPack::IconGeometry& b)
+    {
+        if (! a.isComplete || ! b.isComplete || a.ops.size() != b.ops.size())
+            return false;
+
+        for (auto& op : a.ops)
+        {
+            if (! op.fill.isColour())
+                return false;
+
+           #if JUCE_MAJOR_VERSION >= 8
+            if (op.type == FancyIconPack::IconGeometry::Op::Type::glyph)
+                return false;
+           #endif
+        }
+
+        return true;
+    }
+
+    void writeEntry(juce::MemoryOutputStream& out, const FancyIconPack::IconGeometry& a,
+                    const FancyIconPack::IconGeometry& b, float bakedSize)
+    {
+        using Op = FancyIconPack::IconGeometry::Op;
+
+        // The flags byte leads the entry but is only known once every op has
+        // been classified, so the ops go through a scratch stream first
+        juce::uint8 flags = 0;
+        juce::MemoryOutputStream ops;
+        EntryWriter writer(ops, bakedSize);
+
+        for (int i = 0; i < a.ops.size(); ++i)
+        {
+            auto& op = a.ops.getReference(i);
+            writer.writeColour(op.fill.colour, b.ops.getReference(i).fill.colour, flags);
+
+            switch (op.type)
+            {
+                case Op::Type::path:
+                    writer.writePath(op.path);
+                    break;
+
+                case Op::Type::rectangle:
+                    writer.writeRectangle(op.rectangle);
+                    break;
+
+                case Op::Type::glyph:
+                {
+                   #if JUCE_MAJOR_VERSION < 8
+                    juce::Path outline;
+
+                    if (op.font.getTypefacePtr()->getOutlineForGlyph(op.glyph, outline))
+                    {
+                        auto height = op.font.getHeight();
+                        outline.applyTransform(juce::AffineTransform::scale(height * op.font.getHorizontalScale(), height)
+                                                   .followedBy(op.glyphTransform));
+                        writer.writePath(outline);
+                    }
+
+                    flags |= approximateText;
+                   #endif
+                    break;
+                }
+            }
+        }
+
+        ops.writeByte((char) opEnd);
+
+        out.writeByte((char) flags);
+        out.write(ops.getData(), ops.getDataSize());
+    }
+}
+
+juce::MemoryBlock FancyIconPack::BakedIconSet::bake(const juce::Array<float>& sizes, float physicalPixelScale)
+{
+    auto numSizes = sizes.size();
+    auto tableSize = (size_t) (numIcons * numSizes) * sizeof(juce::uint32);
+    auto entriesStart = (size_t) headerSize + (size_t) numSizes * sizeof(juce::uint16) + tableSize;
+
+    juce::MemoryOutputStream entries;
+    juce::Array<juce::uint32> offsets;
+
+    for (int icon = 0; icon < numIcons; ++icon)
+    {
+        for (auto size : sizes)
+        {
+            // Unselected icons stay absent, so the blob layout matches a full build
+            if (! isIconSelected(static_cast<IconId>(icon)))
+            {
+                offsets.add(0);
+                continue;
+            }
+
+            juce::Rectangle<float> bounds(size, size);
+            auto a = recordIcon(static_cast<IconId>(icon), bounds, probeA, physicalPixelScale);
+            auto b = recordIcon(static_cast<IconId>(icon), bounds, probeB, physicalPixelScale);
+
+            if (! isBakeable(a, b))
+            {
+                offsets.add(0);
+                continue;
+            }
+
+            offsets.add((juce::uint32) (entriesStart + entries.getDataSize()));
+            writeEntry(entries, a, b, size);
+        }
+    }
+
+    juce::MemoryOutputStream out;
+    out.write(bakedMagic, sizeof(bakedMagic));
+    out.writeShort((short) bakedVersion);
+    out.writeShort((short) numIcons);
+    out.writeShort((short) numSizes);
+    out.writeShort((short) juce::roundToInt(physicalPixelScale * sizeScale));
+    out.writeInt((int) probeA.getARGB());
+
+    for (auto size : sizes)
+        out.writeShort((short) juce::roundToInt(size * sizeScale));
+
+    for (auto offset : offsets)
+        out.writeInt((int) offset);
+
+    out.write(entries.getData(), entries.getDataSize());
+    return out.getMemoryBlock();
+}
+
+FancyIconPack::BakedIconSet::BakedIconSet(const void* blob, size_t blobSize) noexcept
+    : data(static_cast<const juce::uint8*>(blob)), dataSize(blobSize)
+{
+    if (data == nullptr || dataSize < (size_t) headerSize || std::memcmp(data, bakedMagic, sizeof(bakedMagic)) != 0)
+        return;
+
+    numSizes = (int) juce::ByteOrder::littleEndianShort(data + 8);
+    bakedScale = (float) juce::ByteOrder::littleEndianShort(data + 10) / sizeScale;
+
+    auto tableEnd = (size_t) headerSize + (size_t) numSizes * sizeof(juce::uint16)
+                  + (size_t) (numIcons * numSizes) * sizeof(juce::uint32);
+
+    valid = juce::ByteOrder::littleEndianShort(data + 4) == bakedVersion
+         && juce::ByteOrder::littleEndianShort(data + 6) == numIcons
+         && dataSize >= tableEnd;
+}
+
+const juce::uint8* FancyIconPack::BakedIconSet::findEntry(IconId icon, float size) const noexcept
+{
+    if (! valid)
+        return nullptr;
+
+    auto* sizeTable = data + headerSize;
+    auto* offsetTable = sizeTable + numSizes * (int) sizeof(juce::uint16);
+
+    for (int i = 0; i < numSizes; ++i)
+    {
+        auto bakedSize = (float) juce::ByteOrder::littleEndianShort(sizeTable + i * 2) / sizeScale;
+
+        if (std::abs(bakedSize - size) < 1.0f / sizeScale)
+        {
+            auto index = static_cast<int>(icon) * numSizes + i;
+            auto offset = juce::ByteOrder::littleEndianInt(offsetTable + index * 4);
+            return (offset != 0 && offset < dataSize) ? data + offset : nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+bool FancyIconPack::BakedIconSet::contains(IconId icon, float size) const noexcept
+{
+    return findEntry(icon, size) != nullptr;
+}
+
+void FancyIconPack::BakedIconSet::draw(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds,
+                                       juce::Colour color) const
+{
+    const Stats::ScopedDrawTimer timer(icon, Stats::DrawPath::baked);
+
+    // Icons that derive extra tones from the base color only match the live
+    // output for the probe color they were baked with, unhinted glyph outlines
+    // only approximate the live text, and curve flattening depends on the
+    // display scale, so all of those take the live path
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (bounds.getWidth() == bounds.getHeight() && std::abs(scale - bakedScale) < 1.0f / sizeScale)
+    {
+        if (auto* entry = findEntry(icon, bounds.getWidth()))
+        {
+            if ((entry[0] & (derivedColours | approximateText)) == 0)
+            {
+                drawEntry(g, entry, bounds, color);
+                return;
+            }
+        }
+    }
+
+    drawIcon(g, icon, bounds, color);
+}
+
+juce::String FancyIconPack::BakedIconSet::createLiveIconSelection() const
+{
+    juce::String selection;
+
+    for (int i = 0; i < numIcons; ++i)
+    {
+        auto needsLive = ! valid || numSizes == 0;
+
+        for (int s = 0; s < numSizes && ! needsLive; ++s)
+        {
+            auto offset = juce::ByteOrder::littleEndianInt(data + headerSize + numSizes * (int) sizeof(juce::uint16)
+                                                           + (i * numSizes + s) * 4);
+
+            needsLive = offset == 0 || offset >= dataSize
+                     || (data[offset] & (derivedColours | approximateText)) != 0;
+        }
+
+        if (needsLive)
+            selection << (selection.isEmpty() ? "" : " ") << "X(" << getIconName(static_cast<IconId>(i)) << ")";
+    }
+
+    return selection;
+}
+
+void FancyIconPack::BakedIconSet::drawEntry(juce::Graphics& g, const juce::uint8* entry,
+                                            juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    auto* p = entry + 1;
+    auto* end = data + dataSize;
+    auto scaleX = bounds.getWidth() / coordinateScale;
+    auto scaleY = bounds.getHeight() / coordinateScale;
+    auto originX = bounds.getX();
+    auto originY = bounds.getY();
+
+    auto readX = [&] { auto v = (juce::int16) juce::ByteOrder::littleEndianShort(p); p += 2; return originX + v * scaleX; };
+    auto readY = [&] { auto v = (juce::int16) juce::ByteOrder::littleEndianShort(p); p += 2; return originY + v * scaleY; };
+
+    // Operand bytes following each op code, so a truncated entry stops before reading past the blob
+    auto getOperandSize = [](juce::uint8 op)
+    {
+        switch (op)
+        {
+            case opBaseAlpha:       return 1;
+            case opLiteralColour:   return 4;
+            case opMoveTo:
+            case opLineTo:          return 4;
+            case opQuadTo:          return 8;
+            case opCubicTo:         return 12;
+            case opFillRect:        return 8;
+            default:                return 0;
+        }
+    };
+
+    juce::Path path;
+    path.preallocateSpace(64);
+
+    while (p < end)
+    {
+        auto op = *p++;
+
+        if (getOperandSize(op) > end - p)
+        {
+            jassertfalse; // truncated data
+            return;
+        }
+
+        switch (op)
+        {
+            case opEnd:
+                return;
+
+            case opBaseColour:
+                g.setColour(color);
+                break;
+
+            case opBaseAlpha:
+                g.setColour(color.withAlpha(*p++));
+                break;
+
+            case opLiteralColour:
+                g.setColour(juce::Colour(juce::ByteOrder::littleEndianInt(p)));
+                p += 4;
+                break;
+
+            case opMoveTo:
+            {
+                auto x = readX(); auto y = readY();
+                path.startNewSubPath(x, y);
+                break;
+            }
+
+            case opLineTo:
+            {
+                auto x = readX(); auto y = readY();
+                path.lineTo(x, y);
+                break;
+            }
+
+            case opQuadTo:
+            {
+                auto x1 = readX(); auto y1 = readY();
+                auto x2 = readX(); auto y2 = readY();
+                path.quadraticTo(x1, y1, x2, y2);
+                break;
+            }
+
+            case opCubicTo:
+            {
+                auto x1 = readX(); auto y1 = readY();
+                auto x2 = readX(); auto y2 = readY();
+                auto x3 = readX(); auto y3 = readY();
+                path.cubicTo(x1, y1, x2, y2, x3, y3);
+                break;
+            }
+
+            case opClose:
+                path.closeSubPath();
+                break;
+
+            case opFillNonZero:
+            case opFillEvenOdd:
+                path.setUsingNonZeroWinding(op == opFillNonZero);
+                g.fillPath(path);
+                path.clear();
+                break;
+
+            case opFillRect:
+            {
+                auto x = readX(); auto y = readY();
+                auto w = readX() - originX; auto h = readY() - originY;
+                g.fillRect(juce::Rectangle<float>(x, y, w, h));
+                break;
+            }
+
+            default:
+                jassertfalse; // corrupt or newer-format data
+                return;
+        }
+    }
+}
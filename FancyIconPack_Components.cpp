@@ -0,0 +1,230 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// ICON COMPONENTS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    using ColourIds = FancyIconPack::IconComponent::ColourIds;
+
+    /** The palette for a component's ColourIds, with unset roles derived from the icon color */
+    FancyIconPack::RolePalette findPalette(const juce::Component& component)
+    {
+        auto isSet = [&component](int colourId)
+        {
+            return component.isColourSpecified(colourId) || component.getLookAndFeel().isColourSpecified(colourId);
+        };
+
+        auto iconColor = isSet(ColourIds::iconColourId) ? component.findColour(ColourIds::iconColourId)
+                                                        : juce::Colour(0xff888888);
+        auto palette = FancyIconPack::RolePalette::fromColor(iconColor);
+
+        const int roleIds[] { ColourIds::iconColourId, ColourIds::iconSecondaryColourId,
+                              ColourIds::iconAccentColourId, ColourIds::iconWarningColourId,
+                              ColourIds::iconShadeColourId };
+
+        for (int i = 1; i < FancyIconPack::numColorRoles; ++i)
+            if (isSet(roleIds[i]))
+                palette.colors[i] = component.findColour(roleIds[i]);
+
+        return palette;
+    }
+
+    /**
+     * The background set on the component, a parent or the LookAndFeel; transparent when none is,
+     * since no LookAndFeel defines backgroundColourId and findColour() would assert and return black
+     */
+    juce::Colour findBackground(const juce::Component& component)
+    {
+        for (auto* c = &component; c != nullptr; c = c->getParentComponent())
+            if (c->isColourSpecified(ColourIds::backgroundColourId))
+                return c->findColour(ColourIds::backgroundColourId);
+
+        auto& lookAndFeel = component.getLookAndFeel();
+
+        return lookAndFeel.isColourSpecified(ColourIds::backgroundColourId)
+                   ? lookAndFeel.findColour(ColourIds::backgroundColourId)
+                   : juce::Colours::transparentBlack;
+    }
+
+    /** Opaque backgrounds let JUCE skip painting whatever is behind the component */
+    void updateOpacity(juce::Component& component)
+    {
+        component.setOpaque(findBackground(component).isOpaque());
+    }
+
+    void fillBackground(juce::Graphics& g, const juce::Component& component)
+    {
+        auto background = findBackground(component);
+
+        if (! background.isTransparent())
+            g.fillAll(background);
+    }
+
+    FancyIconPack::RolePalette withState(FancyIconPack::RolePalette palette, bool isEnabled, bool isHighlighted,
+                                         bool isPressed)
+    {
+        for (auto& color : palette.colors)
+            color = FancyIconPack::getStateColor(isEnabled, isHighlighted, isPressed, color);
+
+        return palette;
+    }
+}
+
+// ============================================================================
+// CachedIcon
+// ============================================================================
+
+FancyIconPack::CachedIcon::CachedIcon(IconId iconToDraw)
+    : icon(iconToDraw)
+{
+}
+
+void FancyIconPack::CachedIcon::setIcon(IconId newIcon)
+{
+    if (newIcon == icon)
+        return;
+
+    icon = newIcon;
+    layers.reset();
+}
+
+void FancyIconPack::CachedIcon::draw(juce::Graphics& g, juce::Rectangle<float> bounds, const RolePalette& palette)
+{
+    const Stats::ScopedDrawTimer timer(icon, Stats::DrawPath::cached);
+    auto currentScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    juce::Point<float> currentSize(bounds.getWidth(), bounds.getHeight());
+
+    if (layers == nullptr || currentSize != size || currentScale != scale)
+    {
+        size = currentSize;
+        scale = currentScale;
+        layers = LayeredIcon::getCached(icon, size, scale);
+    }
+
+    if (layers->isComplete())
+        layers->draw(g, bounds.getPosition(), palette);
+    else
+        drawCached(g, icon, bounds, palette[ColorRole::primary]);
+}
+
+// ============================================================================
+// IconComponent
+// ============================================================================
+
+FancyIconPack::IconComponent::IconComponent(IconId icon)
+    : cachedIcon(icon)
+{
+    updateColours();
+}
+
+void FancyIconPack::IconComponent::setIcon(IconId newIcon)
+{
+    if (newIcon == getIcon())
+        return;
+
+    cachedIcon.setIcon(newIcon);
+    repaint(getIconBounds().getSmallestIntegerContainer());
+}
+
+void FancyIconPack::IconComponent::setPadding(float paddingRatio)
+{
+    padding = paddingRatio;
+    repaint();
+}
+
+juce::Rectangle<float> FancyIconPack::IconComponent::getIconBounds() const
+{
+    return applyPadding(getLocalBounds().toFloat(), padding);
+}
+
+void FancyIconPack::IconComponent::paint(juce::Graphics& g)
+{
+    fillBackground(g, *this);
+
+    auto iconBounds = getIconBounds();
+
+    if (g.clipRegionIntersects(iconBounds.getSmallestIntegerContainer()))
+        cachedIcon.draw(g, iconBounds, isEnabled() ? palette : withState(palette, false, false, false));
+}
+
+void FancyIconPack::IconComponent::updateColours()
+{
+    palette = findPalette(*this);
+    updateOpacity(*this);
+}
+
+void FancyIconPack::IconComponent::colourChanged()
+{
+    updateColours();
+    repaint();
+}
+
+void FancyIconPack::IconComponent::lookAndFeelChanged()
+{
+    updateColours();
+    repaint();
+}
+
+void FancyIconPack::IconComponent::enablementChanged()
+{
+    repaint(getIconBounds().getSmallestIntegerContainer());
+}
+
+// ============================================================================
+// IconButton
+// ============================================================================
+
+FancyIconPack::IconButton::IconButton(const juce::String& name, IconId icon)
+    : juce::Button(name), cachedIcon(icon)
+{
+    updateColours();
+}
+
+void FancyIconPack::IconButton::setIcon(IconId newIcon)
+{
+    if (newIcon == getIcon())
+        return;
+
+    cachedIcon.setIcon(newIcon);
+    repaint(getIconBounds().getSmallestIntegerContainer());
+}
+
+void FancyIconPack::IconButton::setPadding(float paddingRatio)
+{
+    padding = paddingRatio;
+    repaint();
+}
+
+juce::Rectangle<float> FancyIconPack::IconButton::getIconBounds() const
+{
+    return applyPadding(getLocalBounds().toFloat(), padding);
+}
+
+void FancyIconPack::IconButton::paintButton(juce::Graphics& g, bool shouldDrawButtonAsHighlighted,
+                                            bool shouldDrawButtonAsDown)
+{
+    fillBackground(g, *this);
+
+    cachedIcon.draw(g, getIconBounds(),
+                    withState(palette, isEnabled(), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown));
+}
+
+void FancyIconPack::IconButton::updateColours()
+{
+    palette = findPalette(*this);
+    updateOpacity(*this);
+}
+
+void FancyIconPack::IconButton::colourChanged()
+{
+    updateColours();
+    repaint();
+}
+
+void FancyIconPack::IconButton::lookAndFeelChanged()
+{
+    updateColours();
+    repaint();
+}
@@ -0,0 +1,387 @@
+#include "FancyIconPack.h"
+
+#if FANCYICONPACK_ENABLE_SIMD && JUCE_LITTLE_ENDIAN
+ #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define FANCYICONPACK_SIMD_X86 1
+  #include <immintrin.h>
+
+  #if JUCE_GCC || JUCE_CLANG
+   #define FANCYICONPACK_AVX2_TARGET __attribute__ ((target ("avx2")))
+  #else
+   #define FANCYICONPACK_AVX2_TARGET
+  #endif
+ #elif defined (__ARM_NEON) || defined (__ARM_NEON__) || defined (_M_ARM64)
+  #define FANCYICONPACK_SIMD_NEON 1
+  #include <arm_neon.h>
+ #endif
+#endif
+
+// ============================================================================
+// MASK COMPOSITING IMPLEMENTATION
+// ============================================================================
+// Every kernel computes, per channel of the premultiplied color c, coverage m
+// and destination d:
+//
+//     s   = c * m / 255
+//     out = s + d * (255 - s.alpha) / 255
+//
+// with each division rounded by the same exact div255, so all kernels agree
+// bit for bit. Vector kernels assume the little-endian BGRA byte order.
+
+namespace
+{
+    using RowFunction = void (*)(juce::uint8* dest, const juce::uint8* mask, int numPixels, const juce::uint8* color);
+
+   #if JUCE_LITTLE_ENDIAN
+    constexpr int alphaIndex = 3;
+   #else
+    constexpr int alphaIndex = 0;
+   #endif
+
+    inline int div255(int x) noexcept
+    {
+        x += 128;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    void compositeRowScalar(juce::uint8* dest, const juce::uint8* mask, int numPixels, const juce::uint8* color)
+    {
+        for (int i = 0; i < numPixels; ++i, dest += 4)
+        {
+            int coverage = mask[i];
+
+            if (coverage == 0)
+                continue;
+
+            auto inverse = 255 - div255(color[alphaIndex] * coverage);
+
+            for (int k = 0; k < 4; ++k)
+                dest[k] = (juce::uint8) (div255(color[k] * coverage) + div255(dest[k] * inverse));
+        }
+    }
+
+   #if FANCYICONPACK_SIMD_X86
+    inline __m128i div255(__m128i x) noexcept
+    {
+        x = _mm_add_epi16(x, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+    }
+
+    /** Two pixels, widened to 16 bits per channel */
+    inline __m128i blendPixels(__m128i dest, __m128i coverage, __m128i color) noexcept
+    {
+        auto source = div255(_mm_mullo_epi16(color, coverage));
+        auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        auto inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+        return _mm_add_epi16(source, div255(_mm_mullo_epi16(dest, inverse)));
+    }
+
+    inline bool isEmpty(__m128i coverage) noexcept
+    {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(coverage, _mm_setzero_si128())) == 0xffff;
+    }
+
+    void compositeRowSSE2(juce::uint8* dest, const juce::uint8* mask, int numPixels, const juce::uint8* color)
+    {
+        const auto zero = _mm_setzero_si128();
+
+        juce::uint32 packedColor;
+        std::memcpy(&packedColor, color, sizeof(packedColor));
+        const auto color16 = _mm_unpacklo_epi8(_mm_set1_epi32((int) packedColor), zero);
+
+        int i = 0;
+
+        for (; i + 8 <= numPixels; i += 8)
+        {
+            auto coverage8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i));
+
+            if (isEmpty(coverage8))
+                continue;
+
+            // Each coverage byte repeated across its pixel's four channels
+            auto coverage16 = _mm_unpacklo_epi8(coverage8, zero);
+            auto first = _mm_unpacklo_epi16(coverage16, coverage16);
+            auto second = _mm_unpackhi_epi16(coverage16, coverage16);
+
+            auto* pixels = reinterpret_cast<__m128i*>(dest + i * 4);
+            auto a = _mm_loadu_si128(pixels);
+            auto b = _mm_loadu_si128(pixels + 1);
+
+            a = _mm_packus_epi16(blendPixels(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi32(first, first), color16),
+                                 blendPixels(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi32(first, first), color16));
+            b = _mm_packus_epi16(blendPixels(_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi32(second, second), color16),
+                                 blendPixels(_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi32(second, second), color16));
+
+            _mm_storeu_si128(pixels, a);
+            _mm_storeu_si128(pixels + 1, b);
+        }
+
+        compositeRowScalar(dest + i * 4, mask + i, numPixels - i, color);
+    }
+
+    FANCYICONPACK_AVX2_TARGET inline __m256i div255(__m256i x) noexcept
+    {
+        x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+    }
+
+    /** Four pixels, widened to 16 bits per channel */
+    FANCYICONPACK_AVX2_TARGET inline __m256i blendPixels(__m256i dest, __m256i coverage, __m256i color) noexcept
+    {
+        auto source = div255(_mm256_mullo_epi16(color, coverage));
+        auto alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3)),
+                                            _MM_SHUFFLE(3, 3, 3, 3));
+        auto inverse = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+        return _mm256_add_epi16(source, div255(_mm256_mullo_epi16(dest, inverse)));
+    }
+
+    FANCYICONPACK_AVX2_TARGET
+    void compositeRowAVX2(juce::uint8* dest, const juce::uint8* mask, int numPixels, const juce::uint8* color)
+    {
+        juce::uint32 packedColor;
+        std::memcpy(&packedColor, color, sizeof(packedColor));
+        const auto color16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int) packedColor), _mm256_setzero_si256());
+        const auto spread = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+
+        int i = 0;
+
+        for (; i + 8 <= numPixels; i += 8)
+        {
+            auto coverage8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask + i));
+
+            if (isEmpty(coverage8))
+                continue;
+
+            auto first = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(coverage8, spread));
+            auto second = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(_mm_srli_si128(coverage8, 4), spread));
+
+            auto* pixels = reinterpret_cast<__m256i*>(dest + i * 4);
+            auto d = _mm256_loadu_si256(pixels);
+
+            auto low = blendPixels(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(d)), first, color16);
+            auto high = blendPixels(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(d, 1)), second, color16);
+
+            // packus works per 128-bit lane, leaving pixel pairs in 0-1, 4-5, 2-3, 6-7 order
+            auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(pixels, packed);
+        }
+
+        compositeRowScalar(dest + i * 4, mask + i, numPixels - i, color);
+    }
+   #endif
+
+   #if FANCYICONPACK_SIMD_NEON
+    inline uint8x8_t div255(uint16x8_t x) noexcept
+    {
+        return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+    }
+
+    void compositeRowNeon(juce::uint8* dest, const juce::uint8* mask, int numPixels, const juce::uint8* color)
+    {
+        int i = 0;
+
+        for (; i + 8 <= numPixels; i += 8)
+        {
+            auto coverage = vld1_u8(mask + i);
+
+            if (vget_lane_u64(vreinterpret_u64_u8(coverage), 0) == 0)
+                continue;
+
+            // De-interleaved, so each channel is its own vector of 8 pixels
+            auto pixels = vld4_u8(dest + i * 4);
+            auto inverse = vsub_u8(vdup_n_u8(255), div255(vmull_u8(vdup_n_u8(color[alphaIndex]), coverage)));
+
+            for (int k = 0; k < 4; ++k)
+                pixels.val[k] = vqadd_u8(div255(vmull_u8(vdup_n_u8(color[k]), coverage)),
+                                         div255(vmull_u8(pixels.val[k], inverse)));
+
+            vst4_u8(dest + i * 4, pixels);
+        }
+
+        compositeRowScalar(dest + i * 4, mask + i, numPixels - i, color);
+    }
+   #endif
+
+    RowFunction getRowFunction(FancyIconPack::SimdLevel level) noexcept
+    {
+        switch (level)
+        {
+           #if FANCYICONPACK_SIMD_X86
+            case FancyIconPack::SimdLevel::sse2:  return compositeRowSSE2;
+            case FancyIconPack::SimdLevel::avx2:  return compositeRowAVX2;
+           #endif
+           #if FANCYICONPACK_SIMD_NEON
+            case FancyIconPack::SimdLevel::neon:  return compositeRowNeon;
+           #endif
+            default:                              return compositeRowScalar;
+        }
+    }
+
+    const char* getLevelName(FancyIconPack::SimdLevel level) noexcept
+    {
+        switch (level)
+        {
+            case FancyIconPack::SimdLevel::scalar: return "scalar";
+            case FancyIconPack::SimdLevel::sse2:   return "sse2";
+            case FancyIconPack::SimdLevel::avx2:   return "avx2";
+            case FancyIconPack::SimdLevel::neon:   return "neon";
+        }
+
+        return "";
+    }
+
+    bool isSupported(FancyIconPack::SimdLevel level)
+    {
+        using SimdLevel = FancyIconPack::SimdLevel;
+        auto best = FancyIconPack::getSimdLevel();
+
+        return level == SimdLevel::scalar || level == best || (level == SimdLevel::sse2 && best == SimdLevel::avx2);
+    }
+}
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+FancyIconPack::SimdLevel FancyIconPack::getSimdLevel()
+{
+   #if FANCYICONPACK_SIMD_X86
+    static const auto level = juce::SystemStats::hasAVX2() ? SimdLevel::avx2 : SimdLevel::sse2;
+    return level;
+   #elif FANCYICONPACK_SIMD_NEON
+    return SimdLevel::neon;
+   #else
+    return SimdLevel::scalar;
+   #endif
+}
+
+void FancyIconPack::compositeMask(juce::Image::BitmapData& dest, juce::Point<int> destPosition,
+                                  const juce::Image::BitmapData& mask, juce::Rectangle<int> maskArea,
+                                  juce::Colour color)
+{
+    compositeMask(dest, destPosition, mask, maskArea, color, getSimdLevel());
+}
+
+void FancyIconPack::compositeMask(juce::Image::BitmapData& dest, juce::Point<int> destPosition,
+                                  const juce::Image::BitmapData& mask, juce::Rectangle<int> maskArea,
+                                  juce::Colour color, SimdLevel level)
+{
+    jassert(dest.pixelFormat == juce::Image::ARGB && mask.pixelFormat == juce::Image::SingleChannel);
+    jassert(isSupported(level));
+
+    if (dest.pixelFormat != juce::Image::ARGB || mask.pixelFormat != juce::Image::SingleChannel
+        || ! isSupported(level))
+        return;
+
+    auto source = maskArea.getIntersection({ mask.width, mask.height });
+    auto target = source + (destPosition - maskArea.getPosition());
+    auto clipped = target.getIntersection({ dest.width, dest.height });
+
+    if (clipped.isEmpty())
+        return;
+
+    source = clipped + (source.getPosition() - target.getPosition());
+
+    if (color.getAlpha() == 0)
+        return;
+
+    auto premultiplied = color.getPixelARGB().getNativeARGB();
+    juce::uint8 colorBytes[4];
+    std::memcpy(colorBytes, &premultiplied, sizeof(colorBytes));
+
+    auto composite = getRowFunction(level);
+
+    for (int y = 0; y < clipped.getHeight(); ++y)
+        composite(dest.getPixelPointer(clipped.getX(), clipped.getY() + y),
+                  mask.getPixelPointer(source.getX(), source.getY() + y),
+                  clipped.getWidth(), colorBytes);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+juce::String FancyIconPack::createCompositeBenchmark(int maskSize, int iterations)
+{
+    constexpr int gridSize = 8;
+    auto color = juce::Colour(0xcc3fa7ff);
+
+    juce::Image mask(juce::Image::SingleChannel, maskSize, maskSize, true);
+
+    {
+        juce::Graphics g(mask);
+        drawIcon(g, IconId::Settings, mask.getBounds().toFloat(), juce::Colours::white);
+    }
+
+    juce::Image dest(juce::Image::ARGB, maskSize * gridSize, maskSize * gridSize, true);
+
+    // Seconds to blit every cell of the grid `iterations` times
+    auto time = [&](auto&& blitGrid)
+    {
+        dest.clear(dest.getBounds(), juce::Colours::black);
+        blitGrid(); // warm up
+
+        auto start = juce::Time::getHighResolutionTicks();
+
+        for (int i = 0; i < iterations; ++i)
+            blitGrid();
+
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    };
+
+    struct Result
+    {
+        juce::String name;
+        double seconds;
+    };
+
+    juce::Array<Result> results;
+
+    results.add({ "drawImageAt (fill alpha)", time([&]
+    {
+        juce::Graphics g(dest);
+        g.setColour(color);
+
+        for (int y = 0; y < gridSize; ++y)
+            for (int x = 0; x < gridSize; ++x)
+                g.drawImageAt(mask, x * maskSize, y * maskSize, true);
+    }) });
+
+    const juce::Image::BitmapData maskData(mask, juce::Image::BitmapData::readOnly);
+
+    for (auto level : { SimdLevel::scalar, SimdLevel::sse2, SimdLevel::avx2, SimdLevel::neon })
+    {
+        if (! isSupported(level))
+            continue;
+
+        results.add({ juce::String("compositeMask ") + getLevelName(level), time([&]
+        {
+            juce::Image::BitmapData destData(dest, juce::Image::BitmapData::readWrite);
+
+            for (int y = 0; y < gridSize; ++y)
+                for (int x = 0; x < gridSize; ++x)
+                    compositeMask(destData, { x * maskSize, y * maskSize }, maskData, { maskSize, maskSize },
+                                  color, level);
+        }) });
+    }
+
+    auto blits = (double) iterations * gridSize * gridSize;
+    auto pixels = blits * maskSize * maskSize;
+    auto baseline = results.getFirst().seconds;
+
+    juce::String report;
+    report << juce::String("Method").paddedRight(' ', 28)
+           << juce::String("us/blit").paddedLeft(' ', 12)
+           << juce::String("Mpx/s").paddedLeft(' ', 12)
+           << juce::String("speedup").paddedLeft(' ', 12) << "\n";
+
+    for (auto& result : results)
+    {
+        report << result.name.paddedRight(' ', 28)
+               << juce::String(result.seconds * 1.0e6 / blits, 3).paddedLeft(' ', 12)
+               << juce::String(pixels / result.seconds * 1.0e-6, 1).paddedLeft(' ', 12)
+               << (juce::String(baseline / result.seconds, 2) + "x").paddedLeft(' ', 12) << "\n";
+    }
+
+    return report;
+}
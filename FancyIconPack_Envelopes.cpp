@@ -0,0 +1,341 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// PARAMETRIC ENVELOPES IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    // Added to every stage weight (in sqrt-seconds) so zero-length stages keep a sliver of width
+    constexpr float minimumStageWeight = 0.05f;
+
+    constexpr int curveSamples = 16;
+
+    float getStageWeight(float seconds) noexcept
+    {
+        return std::sqrt(juce::jmax(0.0f, seconds)) + minimumStageWeight;
+    }
+
+    void mapStage(juce::Array<juce::Point<float>>& points, const juce::Array<juce::Point<float>>& unitPoints,
+                  juce::Point<float> from, juce::Point<float> to)
+    {
+        points.clearQuick();
+
+        // Unit x runs along the stage and unit y from the start level to the end level
+        for (int i = 1; i < unitPoints.size(); ++i)
+        {
+            auto p = unitPoints.getReference(i);
+            points.add({ from.x + (to.x - from.x) * p.x, from.y + (to.y - from.y) * p.y });
+        }
+    }
+
+    void fillDot(juce::Graphics& g, juce::Point<float> centre, float radius)
+    {
+        g.fillEllipse(centre.x - radius, centre.y - radius, radius * 2, radius * 2);
+    }
+}
+
+bool FancyIconPack::EnvelopeShape::operator==(const EnvelopeShape& other) const noexcept
+{
+    return attack == other.attack && decay == other.decay && release == other.release
+        && sustain == other.sustain && attackCurve == other.attackCurve
+        && decayCurve == other.decayCurve && releaseCurve == other.releaseCurve;
+}
+
+// ============================================================================
+// EnvelopePath
+// ============================================================================
+
+FancyIconPack::EnvelopePath::EnvelopePath()
+    : EnvelopePath(EnvelopeShape())
+{
+}
+
+FancyIconPack::EnvelopePath::EnvelopePath(const EnvelopeShape& shape)
+    : current(shape), target(shape)
+{
+    for (int i = 0; i < numStages; ++i)
+        sampleCurve(curves[i], 0.0f);
+
+    updateCurves();
+}
+
+void FancyIconPack::EnvelopePath::setTarget(const EnvelopeShape& newTarget) noexcept
+{
+    target = newTarget;
+}
+
+void FancyIconPack::EnvelopePath::setShape(const EnvelopeShape& shape) noexcept
+{
+    current = target = shape;
+    updateCurves();
+}
+
+bool FancyIconPack::EnvelopePath::advance(float smoothing) noexcept
+{
+    if (current == target)
+        return false;
+
+    auto approach = [smoothing](float& value, float goal)
+    {
+        value += (goal - value) * smoothing;
+
+        if (std::abs(goal - value) < 1.0e-4f * juce::jmax(1.0f, std::abs(goal)))
+            value = goal;
+    };
+
+    approach(current.attack, target.attack);
+    approach(current.decay, target.decay);
+    approach(current.release, target.release);
+    approach(current.sustain, target.sustain);
+    approach(current.attackCurve, target.attackCurve);
+    approach(current.decayCurve, target.decayCurve);
+    approach(current.releaseCurve, target.releaseCurve);
+
+    updateCurves();
+    return true;
+}
+
+void FancyIconPack::EnvelopePath::updateCurves() noexcept
+{
+    const float tensions[numStages] { current.attackCurve, current.decayCurve, current.releaseCurve };
+
+    // Times and sustain only move a stage, so only a tension change needs new samples
+    for (int i = 0; i < numStages; ++i)
+        if (curves[i].tension != tensions[i])
+            sampleCurve(curves[i], tensions[i]);
+}
+
+void FancyIconPack::EnvelopePath::sampleCurve(StageCurve& curve, float tension)
+{
+    curve.tension = tension;
+    curve.points.clearQuick();
+    curve.points.add({ 0.0f, 0.0f });
+
+    auto k = juce::jlimit(-1.0f, 1.0f, tension) * 5.0f;
+
+    if (std::abs(k) > 1.0e-3f)
+    {
+        auto scale = 1.0f / (1.0f - std::exp(-k));
+
+        for (int i = 1; i < curveSamples; ++i)
+        {
+            auto t = i / static_cast<float>(curveSamples);
+            curve.points.add({ t, (1.0f - std::exp(-k * t)) * scale });
+        }
+    }
+
+    curve.points.add({ 1.0f, 1.0f });
+}
+
+FancyIconPack::EnvelopePath::Layout FancyIconPack::EnvelopePath::getLayout(juce::Rectangle<float> area,
+                                                                           float sustainWidth) const noexcept
+{
+    auto hasSustain = sustainWidth > 0.0f;
+    auto levelToY = [&](float level) { return area.getBottom() - level * area.getHeight(); };
+
+    auto attackWeight = getStageWeight(current.attack);
+    auto decayWeight = hasSustain ? getStageWeight(current.decay) : 0.0f;
+    auto releaseWeight = getStageWeight(current.release);
+    auto timedWidth = area.getWidth() * (1.0f - juce::jlimit(0.0f, 1.0f, sustainWidth));
+    auto widthPerWeight = timedWidth / (attackWeight + decayWeight + releaseWeight);
+
+    auto sustainY = levelToY(hasSustain ? juce::jlimit(0.0f, 1.0f, current.sustain) : 1.0f);
+
+    Layout layout;
+    layout.start = { area.getX(), area.getBottom() };
+    layout.peak = { layout.start.x + attackWeight * widthPerWeight, area.getY() };
+    layout.sustainStart = { layout.peak.x + decayWeight * widthPerWeight, sustainY };
+    layout.sustainEnd = { layout.sustainStart.x + area.getWidth() - timedWidth, sustainY };
+    layout.end = { area.getRight(), area.getBottom() };
+    return layout;
+}
+
+const juce::Path& FancyIconPack::EnvelopePath::getPath(juce::Rectangle<float> area, float sustainWidth) const
+{
+    auto layout = getLayout(area, sustainWidth);
+    auto hasSustain = sustainWidth > 0.0f;
+    auto changed = path.isEmpty() || hasSustain != pathHasSustain;
+
+    const juce::Point<float> ends[numStages][2] { { layout.start, layout.peak },
+                                                  { layout.peak, layout.sustainStart },
+                                                  { layout.sustainEnd, layout.end } };
+
+    for (int i = 0; i < numStages; ++i)
+    {
+        auto& segment = segments[i];
+
+        if ((i == decayStage && ! hasSustain)
+            || (! segment.points.isEmpty() && segment.from == ends[i][0] && segment.to == ends[i][1]
+                && segment.tension == curves[i].tension))
+            continue;
+
+        segment.from = ends[i][0];
+        segment.to = ends[i][1];
+        segment.tension = curves[i].tension;
+        mapStage(segment.points, curves[i].points, segment.from, segment.to);
+        changed = true;
+    }
+
+    if (! changed)
+        return path;
+
+    // juce::Path can't splice, but reassembling only copies the mapped points
+    path.clear();
+    path.startNewSubPath(layout.start);
+
+    for (auto& point : segments[attackStage].points)
+        path.lineTo(point);
+
+    if (hasSustain)
+    {
+        for (auto& point : segments[decayStage].points)
+            path.lineTo(point);
+
+        path.lineTo(layout.sustainEnd);
+    }
+
+    for (auto& point : segments[releaseStage].points)
+        path.lineTo(point);
+
+    pathHasSustain = hasSustain;
+    return path;
+}
+
+// ============================================================================
+// Envelope icons
+// ============================================================================
+
+void FancyIconPack::drawADSR(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const EnvelopePath& envelope)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto baseY = iconBounds.getBottom() - iconBounds.getHeight() * 0.15f;
+    auto height = iconBounds.getHeight() * 0.7f;
+    juce::Rectangle<float> area(iconBounds.getX(), baseY - height, iconBounds.getWidth(), height);
+
+    g.setColour(color);
+    g.strokePath(envelope.getPath(area), createStroke(stroke));
+
+    // Base line
+    g.setColour(color.withAlpha(0.4f));
+    g.drawLine(area.getX(), baseY, area.getRight(), baseY, stroke * 0.6f);
+
+    // Stage boundaries
+    auto layout = envelope.getLayout(area);
+    g.setColour(color.withAlpha(0.8f));
+    fillDot(g, layout.peak, stroke * 0.8f);
+    fillDot(g, layout.sustainStart, stroke * 0.8f);
+    fillDot(g, layout.sustainEnd, stroke * 0.8f);
+}
+
+void FancyIconPack::drawAR(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                           const EnvelopePath& envelope)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto baseY = iconBounds.getBottom() - stroke;
+    auto peakY = iconBounds.getY() + iconBounds.getHeight() * 0.2f;
+    juce::Rectangle<float> area(iconBounds.getX(), peakY, iconBounds.getWidth(), baseY - peakY);
+
+    g.setColour(color);
+    g.strokePath(envelope.getPath(area, 0.0f), createStroke(stroke));
+
+    // Phase markers
+    auto layout = envelope.getLayout(area, 0.0f);
+    fillDot(g, layout.start, stroke * 1.5f);
+    fillDot(g, layout.peak, stroke * 1.5f);
+
+    // Labels
+    g.setFont(juce::Font(iconBounds.getHeight() * 0.12f));
+    g.drawText("A", juce::Rectangle<float>(layout.start.x, baseY + stroke * 2, layout.peak.x - layout.start.x,
+                                           iconBounds.getHeight() * 0.15f),
+               juce::Justification::centred);
+    g.drawText("R", juce::Rectangle<float>(layout.peak.x, baseY + stroke * 2, layout.end.x - layout.peak.x,
+                                           iconBounds.getHeight() * 0.15f),
+               juce::Justification::centred);
+}
+
+void FancyIconPack::drawEnv1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const EnvelopePath& envelope)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto envelopeArea = iconBounds.removeFromTop(iconBounds.getHeight() * 0.6f);
+    auto area = envelopeArea.withTop(envelopeArea.getBottom() - envelopeArea.getHeight() * 0.9f);
+
+    g.setColour(color);
+    g.strokePath(envelope.getPath(area), createStroke(stroke));
+
+    // "ENV1" label
+    g.setFont(juce::Font(iconBounds.getHeight() * 0.6f, juce::Font::bold));
+    g.drawText("ENV1", iconBounds, juce::Justification::centred);
+}
+
+void FancyIconPack::drawEnv2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const EnvelopePath& envelope)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto envelopeArea = iconBounds.removeFromTop(iconBounds.getHeight() * 0.6f);
+    auto area = envelopeArea.withTrimmedTop(envelopeArea.getHeight() * 0.1f);
+
+    g.setColour(color);
+    g.strokePath(envelope.getPath(area), createStroke(stroke * 1.2f));
+
+    // Stage indicators
+    auto layout = envelope.getLayout(area);
+    g.setColour(color.withAlpha(0.6f));
+    g.setFont(juce::Font(envelopeArea.getHeight() * 0.12f, juce::Font::bold));
+
+    g.drawText("A", juce::Rectangle<float>(layout.start.x, layout.peak.y - stroke * 3.0f,
+                                           layout.peak.x - layout.start.x, stroke * 3.0f),
+               juce::Justification::centred);
+    g.drawText("D", juce::Rectangle<float>(layout.peak.x, layout.sustainStart.y - stroke * 2.0f,
+                                           layout.sustainStart.x - layout.peak.x, stroke * 2.0f),
+               juce::Justification::centred);
+
+    // "ENV2" label
+    auto labelArea = iconBounds;
+    g.setColour(color);
+    g.setFont(juce::Font(labelArea.getHeight() * 0.7f, juce::Font::bold));
+    g.drawText("2", labelArea, juce::Justification::centred);
+
+    g.setFont(juce::Font(labelArea.getHeight() * 0.4f));
+    g.drawText("ENV", juce::Rectangle<float>(labelArea.getX(), labelArea.getY() - labelArea.getHeight() * 0.2f,
+                                             labelArea.getWidth(), labelArea.getHeight() * 0.4f),
+               juce::Justification::centred);
+}
+
+void FancyIconPack::drawEnvelopeDisplay(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                        const EnvelopePath& envelope)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto area = iconBounds.withTrimmedTop(iconBounds.getHeight() * 0.2f);
+
+    g.setColour(color);
+    g.strokePath(envelope.getPath(area, 0.4f), createStroke(stroke * 1.2f));
+
+    // Phase dots
+    auto layout = envelope.getLayout(area, 0.4f);
+    g.setColour(color.brighter(0.2f));
+
+    for (auto point : { layout.start, layout.peak, layout.sustainStart, layout.sustainEnd, layout.end })
+        fillDot(g, point, stroke * 0.8f);
+
+    // Grid lines
+    g.setColour(color.withAlpha(0.2f));
+    auto gridLines = 3;
+    for (int i = 1; i <= gridLines; ++i)
+    {
+        auto y = iconBounds.getY() + (iconBounds.getHeight() / (gridLines + 1)) * i;
+        g.drawLine(iconBounds.getX(), y, iconBounds.getRight(), y, stroke * 0.3f);
+    }
+}
@@ -514,6 +514,18 @@ void FancyIconPack::drawTab(juce::Graphics& g, juce::Rectangle<float> bounds, ju
 // ============================================================================
 
 void FancyIconPack::drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawSliderHorizontal(g, bounds, color, 0.7f);
+}
+
+void FancyIconPack::drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                         float value)
+{
+    drawSliderHorizontalFrame(g, bounds, color);
+    drawSliderHorizontalThumb(g, bounds, color, value);
+}
+
+void FancyIconPack::drawSliderHorizontalFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -522,9 +534,17 @@ void FancyIconPack::drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<floa
     auto trackY = iconBounds.getCentreY();
     g.setColour(color.withAlpha(0.4f));
     g.drawLine(iconBounds.getX(), trackY, iconBounds.getRight(), trackY, stroke * 2.0f);
+}
+
+void FancyIconPack::drawSliderHorizontalThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                              float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+    auto trackY = iconBounds.getCentreY();
 
     // Thumb
-    auto thumbX = iconBounds.getX() + iconBounds.getWidth() * 0.7f; // Position at 70%
+    auto thumbX = iconBounds.getX() + iconBounds.getWidth() * juce::jlimit(0.0f, 1.0f, value);
     auto thumbSize = iconBounds.getHeight() * 0.6f;
     auto thumbBounds = juce::Rectangle<float>(thumbX - thumbSize * 0.5f, trackY - thumbSize * 0.5f,
                                             thumbSize, thumbSize);
@@ -536,6 +556,18 @@ void FancyIconPack::drawSliderHorizontal(juce::Graphics& g, juce::Rectangle<floa
 }
 
 void FancyIconPack::drawSliderVertical(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawSliderVertical(g, bounds, color, 0.7f);
+}
+
+void FancyIconPack::drawSliderVertical(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                       float value)
+{
+    drawSliderVerticalFrame(g, bounds, color);
+    drawSliderVerticalThumb(g, bounds, color, value);
+}
+
+void FancyIconPack::drawSliderVerticalFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -544,9 +576,17 @@ void FancyIconPack::drawSliderVertical(juce::Graphics& g, juce::Rectangle<float>
     auto trackX = iconBounds.getCentreX();
     g.setColour(color.withAlpha(0.4f));
     g.drawLine(trackX, iconBounds.getY(), trackX, iconBounds.getBottom(), stroke * 2.0f);
+}
 
-    // Thumb
-    auto thumbY = iconBounds.getY() + iconBounds.getHeight() * 0.3f; // Position at 30%
+void FancyIconPack::drawSliderVerticalThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                            float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+    auto trackX = iconBounds.getCentreX();
+
+    // Thumb, with the maximum at the top
+    auto thumbY = iconBounds.getBottom() - iconBounds.getHeight() * juce::jlimit(0.0f, 1.0f, value);
     auto thumbSize = iconBounds.getWidth() * 0.6f;
     auto thumbBounds = juce::Rectangle<float>(trackX - thumbSize * 0.5f, thumbY - thumbSize * 0.5f,
                                             thumbSize, thumbSize);
@@ -558,6 +598,17 @@ void FancyIconPack::drawSliderVertical(juce::Graphics& g, juce::Rectangle<float>
 }
 
 void FancyIconPack::drawKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawKnob(g, bounds, color, 1.0f);
+}
+
+void FancyIconPack::drawKnob(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    drawKnobFrame(g, bounds, color);
+    drawKnobPointer(g, bounds, color, value);
+}
+
+void FancyIconPack::drawKnobFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -571,11 +622,20 @@ void FancyIconPack::drawKnob(juce::Graphics& g, juce::Rectangle<float> bounds, j
 
     g.setColour(color);
     g.drawEllipse(centre.x - radius, centre.y - radius, radius * 2, radius * 2, stroke);
+}
+
+void FancyIconPack::drawKnobPointer(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    auto centre = iconBounds.getCentre();
+    auto radius = juce::jmin(iconBounds.getWidth(), iconBounds.getHeight()) * 0.4f;
 
-    // Pointer line (at 45 degrees)
-    auto angle = juce::MathConstants<float>::pi * 0.25f; // 45 degrees
-    auto pointerEnd = centre + juce::Point<float>(radius * 0.7f * std::cos(angle),
-                                                 radius * 0.7f * std::sin(angle));
+    // Pointer line, clockwise from 12 o'clock over the same 270 degree sweep as a rotary Slider
+    auto angle = knobStartAngle + (knobEndAngle - knobStartAngle) * juce::jlimit(0.0f, 1.0f, value);
+    auto pointerEnd = centre + juce::Point<float>(radius * 0.7f * std::sin(angle),
+                                                 -radius * 0.7f * std::cos(angle));
 
     g.setColour(color.darker(0.5f));
     g.drawLine(centre.x, centre.y, pointerEnd.x, pointerEnd.y, stroke * 1.5f);
@@ -0,0 +1,136 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// GEOMETRY CACHE IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    // Sizes and scales are keyed at 1/64 px so float noise from layout code
+    // doesn't split one logical size into several entries
+    constexpr float keyResolution = 64.0f;
+}
+
+size_t FancyIconPack::GeometryCache::KeyHash::operator()(const Key& key) const noexcept
+{
+    auto h = std::hash<DrawFunction>()(key.draw);
+    h = h * 31 + (size_t) key.width;
+    h = h * 31 + (size_t) key.height;
+    h = h * 31 + (size_t) key.scale;
+    h = h * 31 + (size_t) key.argb;
+    return h;
+}
+
+FancyIconPack::GeometryCache::GeometryCache(size_t maxBytesToUse)
+    : maxBytes(maxBytesToUse)
+{
+}
+
+FancyIconPack::GeometryCache::~GeometryCache()
+{
+    Stats::cacheReleased(bytesResident);
+}
+
+FancyIconPack::GeometryCache& FancyIconPack::GeometryCache::getInstance()
+{
+    static GeometryCache instance;
+    return instance;
+}
+
+std::shared_ptr<const FancyIconPack::IconGeometry>
+FancyIconPack::GeometryCache::getGeometry(IconId icon, juce::Point<float> size, juce::Colour color,
+                                          float physicalPixelScale)
+{
+    return getGeometry(getDrawFunction(icon), size, color, physicalPixelScale);
+}
+
+std::shared_ptr<const FancyIconPack::IconGeometry>
+FancyIconPack::GeometryCache::getGeometry(DrawFunction draw, juce::Point<float> size, juce::Colour color,
+                                          float physicalPixelScale)
+{
+    Key key { draw,
+              juce::roundToInt(size.x * keyResolution),
+              juce::roundToInt(size.y * keyResolution),
+              juce::roundToInt(physicalPixelScale * keyResolution),
+              color.getARGB() };
+
+    const juce::ScopedLock sl(lock);
+
+    auto found = entries.find(key);
+
+    if (found != entries.end())
+    {
+        recency.splice(recency.begin(), recency, found->second.position);
+        Stats::cacheHit();
+        return found->second.geometry;
+    }
+
+    auto geometry = std::make_shared<IconGeometry>(recordDrawing(draw, { size.x, size.y }, color, physicalPixelScale));
+
+    recency.push_front(key);
+
+    Entry entry;
+    entry.geometry = geometry;
+    entry.position = recency.begin();
+    entry.bytes = geometry->getMemoryUsage();
+
+    bytesResident += entry.bytes;
+    Stats::cacheMiss(entry.bytes);
+    entries.emplace(key, std::move(entry));
+    evictIfNeeded();
+
+    return geometry;
+}
+
+void FancyIconPack::GeometryCache::draw(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds,
+                                        juce::Colour color)
+{
+    const Stats::ScopedDrawTimer timer(icon, Stats::DrawPath::cached);
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto geometry = getGeometry(icon, { bounds.getWidth(), bounds.getHeight() }, color, scale);
+
+    if (geometry->isComplete)
+        geometry->draw(g, bounds.getPosition());
+    else
+        drawIcon(g, icon, bounds, color);
+}
+
+void FancyIconPack::GeometryCache::clear()
+{
+    const juce::ScopedLock sl(lock);
+    Stats::cacheReleased(bytesResident);
+    entries.clear();
+    recency.clear();
+    bytesResident = 0;
+}
+
+void FancyIconPack::GeometryCache::setMaxBytes(size_t newMaxBytes)
+{
+    const juce::ScopedLock sl(lock);
+    maxBytes = newMaxBytes;
+    evictIfNeeded();
+}
+
+size_t FancyIconPack::GeometryCache::getBytesResident() const
+{
+    const juce::ScopedLock sl(lock);
+    return bytesResident;
+}
+
+void FancyIconPack::GeometryCache::evictIfNeeded()
+{
+    // Always keep the most recent entry, even if it alone is over budget
+    while (bytesResident > maxBytes && recency.size() > 1)
+    {
+        auto found = entries.find(recency.back());
+        bytesResident -= found->second.bytes;
+        Stats::cacheEvicted(found->second.bytes);
+        entries.erase(found);
+        recency.pop_back();
+    }
+}
+
+void FancyIconPack::drawCached(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    GeometryCache::getInstance().draw(g, icon, bounds, color);
+}
@@ -0,0 +1,218 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// GOLDEN IMAGE VERIFICATION IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    using GoldenImages = FancyIconPack::GoldenImages;
+
+    const char* getStateName(GoldenImages::State state) noexcept
+    {
+        switch (state)
+        {
+            case GoldenImages::State::normal:      return "normal";
+            case GoldenImages::State::highlighted: return "highlighted";
+            case GoldenImages::State::pressed:     return "pressed";
+            case GoldenImages::State::disabled:    return "disabled";
+        }
+
+        return "";
+    }
+
+    juce::Colour getColorForState(GoldenImages::State state, juce::Colour base) noexcept
+    {
+        return FancyIconPack::getStateColor(state != GoldenImages::State::disabled,
+                                            state == GoldenImages::State::highlighted,
+                                            state == GoldenImages::State::pressed,
+                                            base);
+    }
+
+    bool writePNG(const juce::Image& image, const juce::File& file)
+    {
+        file.deleteFile();
+        juce::FileOutputStream stream(file);
+        juce::PNGImageFormat png;
+        return stream.openedOk() && png.writeImageToStream(image, stream);
+    }
+
+    template <typename Callback>
+    void forEachVariant(const GoldenImages::Settings& settings, Callback&& callback)
+    {
+        for (int i = 0; i < FancyIconPack::numIcons; ++i)
+        {
+            auto icon = static_cast<FancyIconPack::IconId>(i);
+
+            if (! FancyIconPack::isIconSelected(icon))
+                continue;
+
+            for (auto size : settings.sizes)
+                for (auto scale : settings.scales)
+                    for (auto state : settings.states)
+                        callback(icon, size, scale, state);
+        }
+    }
+}
+
+juce::Image FancyIconPack::GoldenImages::render(IconId icon, float size, float scale, juce::Colour color,
+                                                RenderMode mode, const BakedIconSet* baked)
+{
+    auto pixels = juce::roundToInt(std::ceil(size * scale));
+    juce::Image image(juce::Image::ARGB, pixels, pixels, true);
+
+    juce::Graphics g(image);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
+    juce::Rectangle<float> bounds(size, size);
+
+    switch (mode)
+    {
+        case RenderMode::live:
+            drawIcon(g, icon, bounds, color);
+            break;
+
+        case RenderMode::cached:
+            drawCached(g, icon, bounds, color);
+            break;
+
+        case RenderMode::baked:
+            jassert(baked != nullptr);
+
+            if (baked != nullptr)
+                baked->draw(g, icon, bounds, color);
+            break;
+    }
+
+    return image;
+}
+
+FancyIconPack::GoldenImages::Comparison FancyIconPack::GoldenImages::compare(const juce::Image& expected,
+                                                                             const juce::Image& actual,
+                                                                             int tolerance)
+{
+    Comparison result;
+
+    if (expected.getBounds() != actual.getBounds())
+    {
+        result.sizeMismatch = true;
+        return result;
+    }
+
+    auto width = expected.getWidth();
+    auto height = expected.getHeight();
+    result.diff = juce::Image(juce::Image::ARGB, width, height, true);
+
+    const juce::Image::BitmapData expectedData(expected, juce::Image::BitmapData::readOnly);
+    const juce::Image::BitmapData actualData(actual, juce::Image::BitmapData::readOnly);
+    const juce::Image::BitmapData diffData(result.diff, juce::Image::BitmapData::writeOnly);
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            auto e = expectedData.getPixelColour(x, y);
+            auto a = actualData.getPixelColour(x, y);
+
+            auto delta = juce::jmax(std::abs((int) e.getAlpha() - (int) a.getAlpha()),
+                                    std::abs((int) e.getRed()   - (int) a.getRed()),
+                                    juce::jmax(std::abs((int) e.getGreen() - (int) a.getGreen()),
+                                               std::abs((int) e.getBlue()  - (int) a.getBlue())));
+
+            result.maxDifference = juce::jmax(result.maxDifference, delta);
+
+            if (delta > tolerance)
+            {
+                ++result.mismatchedPixels;
+                diffData.setPixelColour(x, y, juce::Colour((juce::uint8) 255, 0, 0,
+                                                           (juce::uint8) juce::jmax(96, delta)));
+            }
+            else
+            {
+                diffData.setPixelColour(x, y, e.withMultipliedAlpha(0.25f));
+            }
+        }
+    }
+
+    return result;
+}
+
+juce::String FancyIconPack::GoldenImages::getFileName(IconId icon, float size, float scale, State state)
+{
+    return juce::String(getIconName(icon)) + "_" + juce::String(juce::roundToInt(size)) + "px@"
+         + juce::String(scale, 0) + "x_" + getStateName(state) + ".png";
+}
+
+int FancyIconPack::GoldenImages::writeReferences(const juce::File& directory, const Settings& settings)
+{
+    directory.createDirectory();
+    auto written = 0;
+
+    forEachVariant(settings, [&](IconId icon, float size, float scale, State state)
+    {
+        auto image = render(icon, size, scale, getColorForState(state, settings.baseColor));
+
+        if (writePNG(image, directory.getChildFile(getFileName(icon, size, scale, state))))
+            ++written;
+    });
+
+    return written;
+}
+
+juce::StringArray FancyIconPack::GoldenImages::verify(const juce::File& directory, const Settings& settings,
+                                                      RenderMode mode, const BakedIconSet* baked)
+{
+    juce::StringArray failures;
+
+    forEachVariant(settings, [&](IconId icon, float size, float scale, State state)
+    {
+        auto name = getFileName(icon, size, scale, state);
+        auto file = directory.getChildFile(name);
+        auto reference = juce::ImageFileFormat::loadFrom(file);
+
+        if (! reference.isValid())
+        {
+            failures.add(name + ": missing reference");
+            return;
+        }
+
+        auto actual = render(icon, size, scale, getColorForState(state, settings.baseColor), mode, baked);
+        auto comparison = compare(reference.convertedToFormat(juce::Image::ARGB), actual, settings.tolerance);
+
+        if (comparison.passes(settings))
+            return;
+
+        if (comparison.sizeMismatch)
+        {
+            failures.add(name + ": size differs from reference");
+            return;
+        }
+
+        failures.add(name + ": " + juce::String(comparison.mismatchedPixels) + " pixels differ, max delta "
+                     + juce::String(comparison.maxDifference));
+
+        writePNG(comparison.diff, directory.getChildFile(name.replace(".png", ".diff.png")));
+    });
+
+    return failures;
+}
+
+juce::StringArray FancyIconPack::GoldenImages::compareWithLive(const Settings& settings, RenderMode mode,
+                                                               const BakedIconSet* baked)
+{
+    juce::StringArray failures;
+
+    forEachVariant(settings, [&](IconId icon, float size, float scale, State state)
+    {
+        auto color = getColorForState(state, settings.baseColor);
+        auto comparison = compare(render(icon, size, scale, color),
+                                  render(icon, size, scale, color, mode, baked),
+                                  settings.tolerance);
+
+        if (! comparison.passes(settings))
+            failures.add(getFileName(icon, size, scale, state) + ": " + juce::String(comparison.mismatchedPixels)
+                         + " pixels differ, max delta " + juce::String(comparison.maxDifference));
+    });
+
+    return failures;
+}
@@ -0,0 +1,106 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// GRAIN CLOUD IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    /** Stable vertical scatter for grains without a pan, hashed from their position */
+    float getScatter(float position) noexcept
+    {
+        auto bits = (juce::uint32) juce::roundToInt(position * 65536.0f) * 2654435761u;
+        return (float) (bits >> 8) / (float) (1u << 24) * 2.0f - 1.0f;
+    }
+}
+
+// ============================================================================
+// GrainSnapshot
+// ============================================================================
+
+FancyIconPack::GrainSnapshot::GrainSnapshot(int maxGrains)
+    : capacity(juce::jmax(1, maxGrains))
+{
+    for (auto& buffer : buffers)
+    {
+        buffer.storage.calloc((size_t) capacity * 4);
+        buffer.positions = buffer.storage;
+        buffer.sizes = buffer.positions + capacity;
+        buffer.amplitudes = buffer.sizes + capacity;
+        buffer.pans = buffer.amplitudes + capacity;
+    }
+}
+
+void FancyIconPack::GrainSnapshot::publish(const float* positions, const float* sizes, const float* amplitudes,
+                                           const float* pans, int numGrains) noexcept
+{
+    auto& buffer = buffers[writeIndex];
+    auto num = juce::jlimit(0, capacity, numGrains);
+
+    juce::FloatVectorOperations::copy(buffer.positions, positions, num);
+    juce::FloatVectorOperations::copy(buffer.sizes, sizes, num);
+    juce::FloatVectorOperations::copy(buffer.amplitudes, amplitudes, num);
+
+    if (pans != nullptr)
+        juce::FloatVectorOperations::copy(buffer.pans, pans, num);
+
+    buffer.numGrains = num;
+    buffer.hasPans = pans != nullptr;
+
+    // Swap the filled buffer in and carry on with whichever one it replaced
+    writeIndex = published.exchange(writeIndex | freshBit, std::memory_order_acq_rel) & ~freshBit;
+}
+
+bool FancyIconPack::GrainSnapshot::update() noexcept
+{
+    if ((published.load(std::memory_order_relaxed) & freshBit) == 0)
+        return false;
+
+    readIndex = published.exchange(readIndex, std::memory_order_acq_rel) & ~freshBit;
+    return true;
+}
+
+// ============================================================================
+// GrainCloud
+// ============================================================================
+
+void FancyIconPack::GrainCloud::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                     const GrainSnapshot& snapshot)
+{
+    draw(g, bounds, color, snapshot.getPositions(), snapshot.getSizes(), snapshot.getAmplitudes(),
+         snapshot.getPans(), snapshot.getNumGrains());
+}
+
+void FancyIconPack::GrainCloud::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                     const float* positions, const float* sizes, const float* amplitudes,
+                                     const float* pans, int numGrains)
+{
+    auto stroke = getOptimalStrokeWidth(bounds);
+    auto centreY = bounds.getCentreY();
+    auto spread = bounds.getHeight() * 0.5f;
+
+    for (auto& bucket : buckets)
+        bucket.clear();
+
+    for (int i = 0; i < numGrains; ++i)
+    {
+        // Same size and alpha ranges as drawGranular's grains
+        auto grainSize = (0.5f + juce::jlimit(0.0f, 1.0f, sizes[i]) * 0.8f) * stroke * 2.0f;
+        auto pan = pans != nullptr ? juce::jlimit(-1.0f, 1.0f, pans[i]) : getScatter(positions[i]);
+        auto x = bounds.getX() + juce::jlimit(0.0f, 1.0f, positions[i]) * bounds.getWidth();
+        auto y = centreY + pan * (spread - grainSize * 0.5f);
+
+        auto bucket = juce::jlimit(0, numAlphaBuckets - 1, (int) (amplitudes[i] * numAlphaBuckets));
+        buckets[bucket].addEllipse(x - grainSize * 0.5f, y - grainSize * 0.5f, grainSize, grainSize);
+    }
+
+    for (int i = 0; i < numAlphaBuckets; ++i)
+    {
+        if (buckets[i].isEmpty())
+            continue;
+
+        auto amplitude = (i + 0.5f) / numAlphaBuckets;
+        g.setColour(color.withAlpha(0.4f + amplitude * 0.6f));
+        g.fillPath(buckets[i]);
+    }
+}
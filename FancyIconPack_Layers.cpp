@@ -0,0 +1,442 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// LAYERED ICONS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr size_t maxCachedLayeredIcons = 128;
+
+    // Room around the icon bounds for strokes that straddle the edge, in logical pixels
+    constexpr float maskMargin = 2.0f;
+
+    // Icons are recorded with a mid-tone, saturated color so every derived tone
+    // (brighter, darker, contrasting, withHue) comes out distinguishable
+    const juce::Colour referenceColor = juce::Colour::fromHSV(0.6f, 0.7f, 0.6f, 1.0f);
+
+    // A second recording with an unrelated hue and brightness (so contrasting()
+    // flips too) tells fills that follow the icon color from literal ones
+    const juce::Colour literalProbeColor = juce::Colour::fromHSV(0.15f, 0.7f, 0.95f, 1.0f);
+
+    juce::Colour getRepresentativeColor(const juce::FillType& fill)
+    {
+        return fill.isGradient() ? fill.gradient->getColourAtPosition(0.5) : fill.colour;
+    }
+
+    float getHueDistance(float a, float b) noexcept
+    {
+        auto distance = std::abs(a - b);
+        return juce::jmin(distance, 1.0f - distance);
+    }
+
+    /** The fill with its color replaced by white, keeping alpha, so it draws pure coverage */
+    juce::FillType createCoverageFill(const juce::FillType& fill)
+    {
+        juce::FillType coverage(fill);
+
+        if (fill.isGradient())
+        {
+            for (int i = 0; i < fill.gradient->getNumColours(); ++i)
+                coverage.gradient->setColour(i, juce::Colours::white.withAlpha(fill.gradient->getColour(i).getFloatAlpha()));
+        }
+        else
+        {
+            coverage.setColour(juce::Colours::white.withAlpha(fill.colour.getFloatAlpha()));
+        }
+
+        return coverage;
+    }
+
+    using IconOrientation = FancyIconPack::IconOrientation;
+
+    struct SymmetryEntry
+    {
+        FancyIconPack::IconId icon;
+        FancyIconPack::IconSymmetry symmetry;
+    };
+
+    // Only exact symmetries: the draw code of each variant is its canonical icon's
+    // with the axes rotated or mirrored. MidiIn/Out and CVIn/Out differ in labels
+    // and details, so they keep their own rasters.
+    const SymmetryEntry symmetryTable[] {
+        { FancyIconPack::IconId::ArrowDown,      { FancyIconPack::IconId::ArrowUp,          IconOrientation::flippedVertically } },
+        { FancyIconPack::IconId::ArrowRight,     { FancyIconPack::IconId::ArrowUp,          IconOrientation::rotated90 } },
+        { FancyIconPack::IconId::ArrowLeft,      { FancyIconPack::IconId::ArrowUp,          IconOrientation::rotated270 } },
+        { FancyIconPack::IconId::ScrollVertical, { FancyIconPack::IconId::ScrollHorizontal, IconOrientation::transposed } },
+        { FancyIconPack::IconId::SliderVertical, { FancyIconPack::IconId::SliderHorizontal, IconOrientation::rotated270 } },
+        { FancyIconPack::IconId::Upload,         { FancyIconPack::IconId::Download,         IconOrientation::flippedVertically } }
+    };
+
+    bool swapsAxes(IconOrientation orientation) noexcept
+    {
+        return orientation == IconOrientation::rotated90 || orientation == IconOrientation::rotated270
+            || orientation == IconOrientation::transposed;
+    }
+
+    /** Maps canonical mask coordinates into a width x height box onto the oriented box */
+    juce::AffineTransform getOrientationTransform(IconOrientation orientation, float width, float height) noexcept
+    {
+        switch (orientation)
+        {
+            case IconOrientation::flippedHorizontally: return { -1.0f, 0.0f, width, 0.0f, 1.0f, 0.0f };
+            case IconOrientation::flippedVertically:   return { 1.0f, 0.0f, 0.0f, 0.0f, -1.0f, height };
+            case IconOrientation::rotated90:           return { 0.0f, -1.0f, height, 1.0f, 0.0f, 0.0f };
+            case IconOrientation::rotated180:          return { -1.0f, 0.0f, width, 0.0f, -1.0f, height };
+            case IconOrientation::rotated270:          return { 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, width };
+            case IconOrientation::transposed:          return { 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+            case IconOrientation::normal:              break;
+        }
+
+        return {};
+    }
+
+    /** The canonical pixel that lands on pixel (x, y) of the oriented mask */
+    juce::Point<int> getSourcePixel(IconOrientation orientation, int x, int y, int width, int height) noexcept
+    {
+        switch (orientation)
+        {
+            case IconOrientation::flippedHorizontally: return { width - 1 - x, y };
+            case IconOrientation::flippedVertically:   return { x, height - 1 - y };
+            case IconOrientation::rotated90:           return { y, height - 1 - x };
+            case IconOrientation::rotated180:          return { width - 1 - x, height - 1 - y };
+            case IconOrientation::rotated270:          return { width - 1 - y, x };
+            case IconOrientation::transposed:          return { y, x };
+            case IconOrientation::normal:              break;
+        }
+
+        return { x, y };
+    }
+
+    /** A copy of a canonical mask with the orientation applied, so compositeMask() can walk its rows */
+    juce::Image createOrientedMask(const juce::Image& image, IconOrientation orientation)
+    {
+        const juce::Image::BitmapData mask(image, juce::Image::BitmapData::readOnly);
+        auto swapped = swapsAxes(orientation);
+
+        juce::Image oriented(juce::Image::SingleChannel, swapped ? mask.height : mask.width,
+                             swapped ? mask.width : mask.height, false);
+        juce::Image::BitmapData orientedData(oriented, juce::Image::BitmapData::writeOnly);
+
+        for (int y = 0; y < orientedData.height; ++y)
+        {
+            auto* line = orientedData.getLinePointer(y);
+
+            for (int x = 0; x < orientedData.width; ++x)
+            {
+                auto source = getSourcePixel(orientation, x, y, mask.width, mask.height);
+                line[x * orientedData.pixelStride] = *mask.getPixelPointer(source.x, source.y);
+            }
+        }
+
+        return oriented;
+    }
+
+    struct LayeredKey
+    {
+        FancyIconPack::IconId icon;
+        int width, height, scale;
+
+        bool operator==(const LayeredKey& other) const noexcept
+        {
+            return icon == other.icon && width == other.width && height == other.height && scale == other.scale;
+        }
+    };
+
+    struct LayeredCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<LayeredKey, std::shared_ptr<const FancyIconPack::LayeredIcon>>> entries;
+    };
+}
+
+// ============================================================================
+// RolePalette
+// ============================================================================
+
+FancyIconPack::RolePalette FancyIconPack::RolePalette::fromColor(juce::Colour color)
+{
+    return { { color, color.brighter(0.3f), color.withHue(0.15f), color.withHue(0.0f), color.darker(0.4f) } };
+}
+
+// ============================================================================
+// Icon symmetry
+// ============================================================================
+
+FancyIconPack::IconSymmetry FancyIconPack::getSymmetry(IconId icon) noexcept
+{
+    for (auto& entry : symmetryTable)
+        if (entry.icon == icon && isIconSelected(entry.symmetry.canonical))
+            return entry.symmetry;
+
+    return { icon, IconOrientation::normal };
+}
+
+// ============================================================================
+// LayeredIcon
+// ============================================================================
+
+FancyIconPack::ColorRole FancyIconPack::LayeredIcon::classify(juce::Colour recorded, juce::Colour reference) noexcept
+{
+    auto a = recorded.withAlpha(1.0f);
+    auto b = reference.withAlpha(1.0f);
+
+    if (std::abs(a.getRed() - b.getRed()) <= 2 && std::abs(a.getGreen() - b.getGreen()) <= 2
+        && std::abs(a.getBlue() - b.getBlue()) <= 2)
+        return ColorRole::primary;
+
+    // brighter() and darker() keep the hue but for rounding; contrasting() goes grey
+    if (a.getSaturation() < 0.1f)
+        return ColorRole::secondary;
+
+    if (getHueDistance(a.getHue(), b.getHue()) < 0.03f)
+        return a.getBrightness() < b.getBrightness() ? ColorRole::shade : ColorRole::secondary;
+
+    return getHueDistance(a.getHue(), 0.0f) < 0.05f ? ColorRole::warning : ColorRole::accent;
+}
+
+FancyIconPack::LayeredIcon::LayeredIcon(IconId icon, juce::Point<float> size, float physicalPixelScale)
+    : scale(physicalPixelScale)
+{
+    // Whole physical pixels, so the masks can also be composited at integer positions
+    auto marginPixels = std::ceil(maskMargin * scale);
+    auto margin = marginPixels / scale;
+    maskOffset = { -margin, -margin };
+    maskExtent = { size.x * scale + marginPixels * 2.0f, size.y * scale + marginPixels * 2.0f };
+
+    auto geometry = recordIcon(icon, { size.x, size.y }, referenceColor, scale);
+    auto probed = recordIcon(icon, { size.x, size.y }, literalProbeColor, scale);
+
+    // Icons whose structure depends on the color can't be split per fill
+    complete = geometry.isComplete && probed.isComplete && geometry.ops.size() == probed.ops.size();
+
+    if (! complete)
+        return;
+
+    IconGeometry layers[numColorRoles];
+    juce::Array<IconGeometry> fixedGeometry;
+
+    for (int i = 0; i < geometry.ops.size(); ++i)
+    {
+        auto& op = geometry.ops.getReference(i);
+        auto* layer = &layers[(int) classify(getRepresentativeColor(op.fill), referenceColor)];
+
+        // A fill that came out the same for both recording colors is literal
+        if (op.fill == probed.ops.getReference(i).fill)
+        {
+            // A multi-color gradient can't be expressed as one tinted mask
+            if (op.fill.isGradient())
+            {
+                complete = false;
+                return;
+            }
+
+            auto color = op.fill.colour.withAlpha(1.0f);
+            auto index = 0;
+
+            while (index < fixedLayers.size() && fixedLayers.getReference(index).color != color)
+                ++index;
+
+            if (index == fixedLayers.size())
+            {
+                fixedLayers.add({ color, {} });
+                fixedGeometry.add({});
+            }
+
+            layer = &fixedGeometry.getReference(index);
+        }
+
+        layer->ops.add(op);
+        layer->ops.getReference(layer->ops.size() - 1).fill = createCoverageFill(op.fill);
+    }
+
+    auto width = juce::jmax(1, (int) std::ceil(size.x * scale + marginPixels * 2.0f));
+    auto height = juce::jmax(1, (int) std::ceil(size.y * scale + marginPixels * 2.0f));
+
+    auto rasterise = [&](IconGeometry& layer)
+    {
+        layer.bounds = geometry.bounds;
+        juce::Image mask(juce::Image::SingleChannel, width, height, true);
+
+        juce::Graphics g(mask);
+        g.addTransform(juce::AffineTransform::scale(scale));
+        layer.draw(g, { margin, margin });
+        return mask;
+    };
+
+    for (int i = 0; i < numColorRoles; ++i)
+        if (! layers[i].ops.isEmpty())
+            masks[i] = rasterise(layers[i]);
+
+    for (int i = 0; i < fixedLayers.size(); ++i)
+        fixedLayers.getReference(i).mask = rasterise(fixedGeometry.getReference(i));
+}
+
+FancyIconPack::LayeredIcon::LayeredIcon(const LayeredIcon& canonical, IconOrientation iconOrientation)
+    : maskOffset(canonical.maskOffset),
+      maskExtent(canonical.maskExtent),
+      scale(canonical.scale),
+      orientation(iconOrientation),
+      complete(canonical.complete)
+{
+    jassert(canonical.orientation == IconOrientation::normal);
+
+    // Images are reference counted, so the variant holds no pixels of its own
+    for (int i = 0; i < numColorRoles; ++i)
+        masks[i] = canonical.masks[i];
+
+    fixedLayers = canonical.fixedLayers;
+}
+
+std::shared_ptr<const FancyIconPack::LayeredIcon>
+FancyIconPack::LayeredIcon::getCached(IconId icon, juce::Point<float> size, float physicalPixelScale)
+{
+    static LayeredCache cache;
+
+    LayeredKey key { icon,
+                     juce::roundToInt(size.x * 64.0f),
+                     juce::roundToInt(size.y * 64.0f),
+                     juce::roundToInt(physicalPixelScale * 64.0f) };
+
+    const juce::ScopedLock sl(cache.lock);
+
+    for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+    {
+        if (it->first == key)
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+            return it->second;
+        }
+    }
+
+    auto symmetry = getSymmetry(icon);
+    std::shared_ptr<const LayeredIcon> layered;
+
+    if (symmetry.orientation == IconOrientation::normal)
+    {
+        layered = std::make_shared<const LayeredIcon>(icon, size, physicalPixelScale);
+    }
+    else
+    {
+        // The lock is re-entrant; the canonical entry is cached in its own right
+        auto canonicalSize = swapsAxes(symmetry.orientation) ? juce::Point<float>(size.y, size.x) : size;
+        layered = std::make_shared<const LayeredIcon>(*getCached(symmetry.canonical, canonicalSize, physicalPixelScale),
+                                                      symmetry.orientation);
+    }
+
+    cache.entries.emplace_front(key, layered);
+
+    if (cache.entries.size() > maxCachedLayeredIcons)
+        cache.entries.pop_back();
+
+    return layered;
+}
+
+size_t FancyIconPack::LayeredIcon::getMemoryUsage() const noexcept
+{
+    size_t total = 0;
+
+    if (orientation != IconOrientation::normal)
+    {
+        if (orientedBuilt)
+        {
+            for (auto& mask : orientedMasks)
+                if (mask.isValid())
+                    total += (size_t) mask.getWidth() * (size_t) mask.getHeight();
+
+            for (auto& mask : orientedFixedMasks)
+                total += (size_t) mask.getWidth() * (size_t) mask.getHeight();
+        }
+
+        return total;
+    }
+
+    for (auto& mask : masks)
+        if (mask.isValid())
+            total += (size_t) mask.getWidth() * (size_t) mask.getHeight();
+
+    for (auto& layer : fixedLayers)
+        total += (size_t) layer.mask.getWidth() * (size_t) layer.mask.getHeight();
+
+    return total;
+}
+
+void FancyIconPack::LayeredIcon::draw(juce::Graphics& g, juce::Point<float> origin, const RolePalette& palette) const
+{
+    auto transform = getOrientationTransform(orientation, maskExtent.x, maskExtent.y)
+                         .scaled(1.0f / scale)
+                         .translated(origin + maskOffset);
+
+    for (int i = 0; i < numColorRoles; ++i)
+    {
+        if (! masks[i].isValid())
+            continue;
+
+        g.setColour(palette.colors[i]);
+        g.drawImageTransformed(masks[i], transform, true);
+    }
+
+    for (auto& layer : fixedLayers)
+    {
+        g.setColour(layer.color);
+        g.drawImageTransformed(layer.mask, transform, true);
+    }
+}
+
+void FancyIconPack::LayeredIcon::buildOrientedMasks() const
+{
+    for (int i = 0; i < numColorRoles; ++i)
+        if (masks[i].isValid())
+            orientedMasks[i] = createOrientedMask(masks[i], orientation);
+
+    for (auto& layer : fixedLayers)
+        orientedFixedMasks.add(createOrientedMask(layer.mask, orientation));
+
+    orientedBuilt = true;
+}
+
+void FancyIconPack::LayeredIcon::composite(juce::Image::BitmapData& dest, juce::Point<int> position,
+                                           const RolePalette& palette) const
+{
+    auto maskPosition = position + (maskOffset * scale).roundToInt();
+    auto isOriented = orientation != IconOrientation::normal;
+
+    if (isOriented)
+        std::call_once(orientedOnce, [this] { buildOrientedMasks(); });
+
+    auto compositeLayer = [&](const juce::Image& image, juce::Colour color)
+    {
+        const juce::Image::BitmapData mask(image, juce::Image::BitmapData::readOnly);
+        compositeMask(dest, maskPosition, mask, { mask.width, mask.height }, color);
+    };
+
+    for (int i = 0; i < numColorRoles; ++i)
+        if (masks[i].isValid())
+            compositeLayer(isOriented ? orientedMasks[i] : masks[i], palette.colors[i]);
+
+    for (int i = 0; i < fixedLayers.size(); ++i)
+        compositeLayer(isOriented ? orientedFixedMasks.getReference(i) : fixedLayers.getReference(i).mask,
+                       fixedLayers.getReference(i).color);
+}
+
+// ============================================================================
+// Layered icon drawing
+// ============================================================================
+
+void FancyIconPack::drawLayered(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds,
+                                const RolePalette& palette)
+{
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto layered = LayeredIcon::getCached(icon, { bounds.getWidth(), bounds.getHeight() }, scale);
+
+    if (! layered->isComplete())
+    {
+        drawIcon(g, icon, bounds, palette[ColorRole::primary]);
+        return;
+    }
+
+    const Stats::ScopedDrawTimer timer(icon, Stats::DrawPath::cached);
+    layered->draw(g, bounds.getPosition(), palette);
+}
@@ -0,0 +1,229 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// LIVE METER IMPLEMENTATION
+// ============================================================================
+
+juce::Rectangle<float> FancyIconPack::getMeterBarBounds(juce::Rectangle<float> bounds, int index)
+{
+    jassert(juce::isPositiveAndBelow(index, numMeterBars));
+
+    auto barSpacing = bounds.getWidth() / (numMeterBars + 1);
+    auto barWidth = barSpacing * 0.6f;
+    auto x = bounds.getX() + (index + 0.7f) * barSpacing;
+    auto barHeight = bounds.getHeight() * (0.2f + (index + 1) * 0.12f); // Graduated heights
+    auto y = bounds.getBottom() - barHeight - bounds.getHeight() * 0.1f;
+
+    return { x, y, barWidth, barHeight };
+}
+
+juce::Colour FancyIconPack::getMeterBarColor(juce::Colour color, int index)
+{
+    // Color coding: green -> yellow -> red
+    return (index < 2) ? color : (index < 4) ? color.withHue(0.15f) : color.withHue(0.0f);
+}
+
+void FancyIconPack::drawMeterFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    auto stroke = getOptimalStrokeWidth(bounds);
+
+    g.setColour(color.withAlpha(0.3f));
+    g.fillRoundedRectangle(bounds, 2.0f);
+
+    g.setColour(color);
+    g.drawRoundedRectangle(bounds, 2.0f, stroke);
+
+    // Unlit bar slots
+    for (int i = 0; i < numMeterBars; ++i)
+    {
+        g.setColour(getMeterBarColor(color, i).withAlpha(0.2f));
+        g.fillRoundedRectangle(getMeterBarBounds(bounds, i), 1.0f);
+    }
+}
+
+// ============================================================================
+// MeterLevelQueue
+// ============================================================================
+
+FancyIconPack::MeterLevelQueue::MeterLevelQueue(int capacity)
+    : fifo(capacity), buffer((size_t) capacity)
+{
+}
+
+bool FancyIconPack::MeterLevelQueue::push(float peak, float rms) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+    if (size1 + size2 == 0)
+        return false;
+
+    buffer[size1 > 0 ? start1 : start2] = { peak, rms };
+    fifo.finishedWrite(1);
+    return true;
+}
+
+bool FancyIconPack::MeterLevelQueue::popAll(float& peak, float& rms) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+
+    if (size1 + size2 == 0)
+        return false;
+
+    peak = 0.0f;
+    rms = 0.0f;
+
+    auto accumulate = [&](int start, int size)
+    {
+        for (int i = start; i < start + size; ++i)
+        {
+            peak = juce::jmax(peak, buffer[i].peak);
+            rms = juce::jmax(rms, buffer[i].rms);
+        }
+    };
+
+    accumulate(start1, size1);
+    accumulate(start2, size2);
+
+    fifo.finishedRead(size1 + size2);
+    return true;
+}
+
+// ============================================================================
+// LiveMeter
+// ============================================================================
+
+FancyIconPack::LiveMeter::LiveMeter(const Ballistics& newBallistics)
+    : ballistics(newBallistics)
+{
+}
+
+juce::uint32 FancyIconPack::LiveMeter::update(MeterLevelQueue& queue, float elapsedSeconds)
+{
+    auto peakIn = minimumDb, rmsIn = minimumDb;
+    float peak, rms;
+
+    if (queue.popAll(peak, rms))
+    {
+        peakIn = juce::Decibels::gainToDecibels(peak, minimumDb);
+        rmsIn = juce::Decibels::gainToDecibels(rms, minimumDb);
+    }
+
+    // Rises are shown immediately, falls are limited to the decay rate
+    auto decay = ballistics.decayDbPerSecond * elapsedSeconds;
+    peakDb = juce::jmax(peakIn, peakDb - decay, minimumDb);
+    rmsDb = juce::jmax(rmsIn, rmsDb - decay, minimumDb);
+
+    if (peakDb >= heldDb)
+    {
+        heldDb = peakDb;
+        holdRemaining = ballistics.peakHoldSeconds;
+    }
+    else
+    {
+        holdRemaining -= elapsedSeconds;
+
+        if (holdRemaining <= 0.0f)
+        {
+            holdRemaining = 0.0f;
+            heldDb = juce::jmax(peakDb, heldDb - decay);
+        }
+    }
+
+    juce::uint32 changedBars = 0;
+
+    for (int i = 0; i < numMeterBars; ++i)
+    {
+        auto state = getBarState(i);
+
+        if (state != barStates[i])
+        {
+            barStates[i] = state;
+            changedBars |= 1u << i;
+        }
+    }
+
+    return changedBars;
+}
+
+FancyIconPack::LiveMeter::BarState FancyIconPack::LiveMeter::getBarState(int index) const noexcept
+{
+    auto threshold = ballistics.thresholdsDb[index];
+
+    if (rmsDb >= threshold)   return BarState::rms;
+    if (peakDb >= threshold)  return BarState::peak;
+
+    // Only the loudest bar the held peak reached shows the hold marker
+    auto isHeldBar = heldDb >= threshold
+                  && (index == numMeterBars - 1 || heldDb < ballistics.thresholdsDb[index + 1]);
+
+    return isHeldBar ? BarState::held : BarState::off;
+}
+
+juce::RectangleList<int> FancyIconPack::LiveMeter::getDirtyRegion(juce::Rectangle<float> bounds,
+                                                                  juce::uint32 changedBars)
+{
+    juce::RectangleList<int> region;
+
+    for (int i = 0; i < numMeterBars; ++i)
+        if ((changedBars & (1u << i)) != 0)
+            region.add(getMeterBarBounds(bounds, i).expanded(getOptimalStrokeWidth(bounds)).getSmallestIntegerContainer());
+
+    return region;
+}
+
+void FancyIconPack::LiveMeter::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto frame = GeometryCache::getInstance().getGeometry(&drawMeterFrame, { bounds.getWidth(), bounds.getHeight() },
+                                                          color, scale);
+
+    if (frame->isComplete)
+        frame->draw(g, bounds.getPosition());
+    else
+        drawMeterFrame(g, bounds, color);
+
+    auto stroke = getOptimalStrokeWidth(bounds);
+
+    for (int i = 0; i < numMeterBars; ++i)
+    {
+        auto barBounds = getMeterBarBounds(bounds, i);
+
+        if (barStates[i] == BarState::off
+            || ! g.clipRegionIntersects(barBounds.expanded(stroke).getSmallestIntegerContainer()))
+            continue;
+
+        auto barColor = getMeterBarColor(color, i);
+
+        switch (barStates[i])
+        {
+            case BarState::rms:
+                g.setColour(barColor);
+                g.fillRoundedRectangle(barBounds, 1.0f);
+                break;
+
+            case BarState::peak:
+                g.setColour(barColor.withAlpha(0.5f));
+                g.fillRoundedRectangle(barBounds, 1.0f);
+                break;
+
+            case BarState::held:
+                g.setColour(barColor);
+                g.drawRoundedRectangle(barBounds, 1.0f, stroke * 0.75f);
+                break;
+
+            case BarState::off:
+                break;
+        }
+    }
+}
+
+void FancyIconPack::LiveMeter::reset()
+{
+    peakDb = rmsDb = heldDb = minimumDb;
+    holdRemaining = 0.0f;
+
+    for (auto& state : barStates)
+        state = BarState::off;
+}
@@ -0,0 +1,115 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// LOOK AND FEEL IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    /** Single-tone widget glyphs only need the primary role, so one color builds the palette */
+    void drawWidgetIcon(juce::Graphics& g, FancyIconPack::IconId icon, juce::Rectangle<float> area, juce::Colour color)
+    {
+        auto size = juce::jmin(area.getWidth(), area.getHeight());
+
+        if (size > 0.0f)
+            FancyIconPack::drawLayered(g, icon, area.withSizeKeepingCentre(size, size),
+                                       FancyIconPack::RolePalette::fromColor(color));
+    }
+}
+
+void FancyIconPack::LookAndFeelIcons::drawTickBox(juce::Graphics& g, juce::Component& component,
+                                                  juce::Rectangle<float> area, bool ticked, bool isEnabled,
+                                                  bool isHighlighted, bool isPressed)
+{
+    g.setColour(component.findColour(juce::ToggleButton::tickDisabledColourId));
+    g.drawRoundedRectangle(area, 4.0f, 1.0f);
+
+    if (ticked)
+        drawWidgetIcon(g, IconId::Check, area.reduced(area.getWidth() * 0.15f),
+                       getStateColor(isEnabled, isHighlighted, isPressed,
+                                     component.findColour(juce::ToggleButton::tickColourId)));
+}
+
+void FancyIconPack::LookAndFeelIcons::drawPopupMenuItemIcons(juce::LookAndFeel& lookAndFeel, juce::Graphics& g,
+                                                             juce::Rectangle<int> area, bool isActive,
+                                                             bool isHighlighted, bool isTicked, bool hasSubMenu,
+                                                             const juce::Colour* textColour)
+{
+    if (! isTicked && ! hasSubMenu)
+        return;
+
+    // Same row layout as LookAndFeel_V4::drawPopupMenuItem
+    auto r = area.reduced(1);
+    r.reduce(juce::jmin(5, area.getWidth() / 20), 0);
+
+    auto font = lookAndFeel.getPopupMenuFont();
+    auto maxFontHeight = (float) r.getHeight() / 1.3f;
+
+    if (font.getHeight() > maxFontHeight)
+        font.setHeight(maxFontHeight);
+
+    auto color = isHighlighted && isActive ? lookAndFeel.findColour(juce::PopupMenu::highlightedTextColourId)
+                                           : textColour != nullptr ? *textColour
+                                                                   : lookAndFeel.findColour(juce::PopupMenu::textColourId);
+
+    if (! isActive)
+        color = color.withMultipliedAlpha(0.5f);
+
+    auto iconArea = r.removeFromLeft(juce::roundToInt(maxFontHeight)).toFloat();
+
+    if (isTicked)
+        drawWidgetIcon(g, IconId::Check, iconArea.reduced(iconArea.getWidth() / 5, 0), color);
+
+    if (hasSubMenu)
+    {
+        auto arrowSize = font.getAscent() * 0.6f;
+        drawWidgetIcon(g, IconId::ArrowRight,
+                       { (float) r.getRight() - arrowSize, (float) r.getCentreY() - arrowSize * 0.5f,
+                         arrowSize, arrowSize },
+                       color);
+    }
+}
+
+void FancyIconPack::LookAndFeelIcons::drawComboBox(juce::Graphics& g, int width, int height, juce::ComboBox& box)
+{
+    // Box as LookAndFeel_V4 draws it, with the Dropdown icon for the arrow
+    auto cornerSize = box.findParentComponentOfClass<juce::ChoicePropertyComponent>() != nullptr ? 0.0f : 3.0f;
+    juce::Rectangle<int> boxBounds(0, 0, width, height);
+
+    g.setColour(box.findColour(juce::ComboBox::backgroundColourId));
+    g.fillRoundedRectangle(boxBounds.toFloat(), cornerSize);
+
+    g.setColour(box.findColour(juce::ComboBox::outlineColourId));
+    g.drawRoundedRectangle(boxBounds.toFloat().reduced(0.5f, 0.5f), cornerSize, 1.0f);
+
+    juce::Rectangle<int> arrowZone(width - 30, 0, 20, height);
+    auto arrowColor = box.findColour(juce::ComboBox::arrowColourId).withAlpha(box.isEnabled() ? 0.9f : 0.2f);
+
+    drawWidgetIcon(g, IconId::Dropdown, arrowZone.toFloat().reduced(2.0f), arrowColor);
+}
+
+juce::Button* FancyIconPack::LookAndFeelIcons::createDocumentWindowButton(juce::LookAndFeel& lookAndFeel,
+                                                                          int buttonType)
+{
+    std::unique_ptr<IconButton> button;
+
+    switch (buttonType)
+    {
+        case juce::DocumentWindow::closeButton:    button = std::make_unique<IconButton>("close", IconId::Close); break;
+        case juce::DocumentWindow::minimiseButton: button = std::make_unique<IconButton>("minimise", IconId::Minus); break;
+        case juce::DocumentWindow::maximiseButton: button = std::make_unique<IconButton>("maximise", IconId::Fullscreen); break;
+        default:                                   jassertfalse; return nullptr;
+    }
+
+    // The background stays unset so the title bar shows through
+    button->setColour(IconComponent::iconColourId, lookAndFeel.findColour(juce::DocumentWindow::textColourId));
+    return button.release();
+}
+
+void FancyIconPack::LookAndFeelIcons::drawTreeviewPlusMinusBox(juce::Graphics& g, juce::Rectangle<float> area,
+                                                               juce::Colour backgroundColour, bool isOpen,
+                                                               bool isMouseOver)
+{
+    drawWidgetIcon(g, isOpen ? IconId::ArrowDown : IconId::ArrowRight, area,
+                   getStateColor(true, isMouseOver, false, backgroundColour.contrasting()));
+}
@@ -243,14 +243,52 @@ void FancyIconPack::drawModDestination(juce::Graphics& g, juce::Rectangle<float>
 }
 
 void FancyIconPack::drawModDepth(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawModDepth(g, bounds, color, 1.0f);
+}
+
+void FancyIconPack::drawModDepth(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    drawModDepthFrame(g, bounds, color);
+    drawModDepthWave(g, bounds, color, value);
+}
+
+void FancyIconPack::drawModDepthFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
 
-    // Depth visualization - wave with increasing amplitude
     auto centerY = iconBounds.getCentreY();
     auto baseAmplitude = iconBounds.getHeight() * 0.1f;
     auto maxAmplitude = iconBounds.getHeight() * 0.4f;
+
+    // Depth indicator arrows
+    auto arrowSize = stroke * 2;
+    g.setColour(color);
+
+    // Small depth arrow (left)
+    auto leftX = iconBounds.getX() + iconBounds.getWidth() * 0.2f;
+    g.drawLine(leftX, centerY - baseAmplitude, leftX, centerY + baseAmplitude, stroke);
+    g.fillEllipse(leftX - arrowSize * 0.5f, centerY - baseAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+    g.fillEllipse(leftX - arrowSize * 0.5f, centerY + baseAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+
+    // Large depth arrow (right)
+    auto rightX = iconBounds.getX() + iconBounds.getWidth() * 0.8f;
+    g.drawLine(rightX, centerY - maxAmplitude, rightX, centerY + maxAmplitude, stroke);
+    g.fillEllipse(rightX - arrowSize * 0.5f, centerY - maxAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+    g.fillEllipse(rightX - arrowSize * 0.5f, centerY + maxAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+}
+
+void FancyIconPack::drawModDepthWave(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    // Depth visualization - wave whose amplitude grows towards the depth value
+    auto centerY = iconBounds.getCentreY();
+    auto baseAmplitude = iconBounds.getHeight() * 0.1f;
+    auto maxAmplitude = iconBounds.getHeight() * 0.4f;
+    auto depthAmplitude = baseAmplitude + (maxAmplitude - baseAmplitude) * juce::jlimit(0.0f, 1.0f, value);
     auto points = 12;
 
     juce::Path depthWave;
@@ -263,59 +301,40 @@ void FancyIconPack::drawModDepth(juce::Graphics& g, juce::Rectangle<float> bound
         auto phase = ratio * juce::MathConstants<float>::twoPi * 2.0f;
 
         // Increasing amplitude from left to right
-        auto amplitude = baseAmplitude + (maxAmplitude - baseAmplitude) * ratio;
+        auto amplitude = baseAmplitude + (depthAmplitude - baseAmplitude) * ratio;
         auto amp = std::sin(phase) * amplitude;
         depthWave.lineTo(x, centerY + amp);
     }
 
     g.setColour(color);
     g.strokePath(depthWave, createStroke(stroke));
+}
 
-    // Depth indicator arrows
-    auto arrowSize = stroke * 2;
-
-    // Small depth arrow (left)
-    auto leftX = iconBounds.getX() + iconBounds.getWidth() * 0.2f;
-    g.drawLine(leftX, centerY - baseAmplitude, leftX, centerY + baseAmplitude, stroke);
-    g.fillEllipse(leftX - arrowSize * 0.5f, centerY - baseAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
-    g.fillEllipse(leftX - arrowSize * 0.5f, centerY + baseAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+void FancyIconPack::drawModAmount(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawModAmount(g, bounds, color, 0.7f);
+}
 
-    // Large depth arrow (right)
-    auto rightX = iconBounds.getX() + iconBounds.getWidth() * 0.8f;
-    g.drawLine(rightX, centerY - maxAmplitude, rightX, centerY + maxAmplitude, stroke);
-    g.fillEllipse(rightX - arrowSize * 0.5f, centerY - maxAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
-    g.fillEllipse(rightX - arrowSize * 0.5f, centerY + maxAmplitude - arrowSize * 0.5f, arrowSize, arrowSize);
+void FancyIconPack::drawModAmount(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    drawModAmountFrame(g, bounds, color);
+    drawModAmountThumb(g, bounds, color, value);
 }
 
-void FancyIconPack::drawModAmount(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+void FancyIconPack::drawModAmountFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
 
-    // Amount slider with modulation indicator
+    // Amount slider track
     auto sliderArea = iconBounds.reduced(iconBounds.getWidth() * 0.2f, iconBounds.getHeight() * 0.1f);
     auto sliderTrack = sliderArea.removeFromTop(sliderArea.getHeight() * 0.6f);
 
-    // Slider track
     g.setColour(color.withAlpha(0.4f));
     auto trackThickness = stroke * 2;
     g.fillRoundedRectangle(sliderTrack.getCentreX() - trackThickness * 0.5f, sliderTrack.getY(),
                           trackThickness, sliderTrack.getHeight(), trackThickness * 0.5f);
 
-    // Current amount position (70%)
-    auto amountRatio = 0.7f;
-    auto thumbY = sliderTrack.getY() + sliderTrack.getHeight() * (1.0f - amountRatio);
-    auto thumbSize = iconBounds.getWidth() * 0.15f;
-
-    g.setColour(color);
-    g.fillEllipse(sliderTrack.getCentreX() - thumbSize * 0.5f, thumbY - thumbSize * 0.5f, thumbSize, thumbSize);
-
-    // Modulation range indicator
-    auto modRange = iconBounds.getHeight() * 0.15f;
-    g.setColour(color.withAlpha(0.6f));
-    g.fillRoundedRectangle(sliderTrack.getCentreX() - trackThickness * 1.5f, thumbY - modRange * 0.5f,
-                          trackThickness * 3, modRange, trackThickness);
-
     // Amount scale marks
     g.setColour(color.withAlpha(0.7f));
     for (int i = 0; i <= 4; ++i)
@@ -332,6 +351,30 @@ void FancyIconPack::drawModAmount(juce::Graphics& g, juce::Rectangle<float> boun
     g.drawText("AMT", labelArea, juce::Justification::centred);
 }
 
+void FancyIconPack::drawModAmountThumb(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                       float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+    auto sliderArea = iconBounds.reduced(iconBounds.getWidth() * 0.2f, iconBounds.getHeight() * 0.1f);
+    auto sliderTrack = sliderArea.removeFromTop(sliderArea.getHeight() * 0.6f);
+    auto trackThickness = stroke * 2;
+
+    // Current amount position
+    auto amountRatio = juce::jlimit(0.0f, 1.0f, value);
+    auto thumbY = sliderTrack.getY() + sliderTrack.getHeight() * (1.0f - amountRatio);
+    auto thumbSize = iconBounds.getWidth() * 0.15f;
+
+    g.setColour(color);
+    g.fillEllipse(sliderTrack.getCentreX() - thumbSize * 0.5f, thumbY - thumbSize * 0.5f, thumbSize, thumbSize);
+
+    // Modulation range indicator
+    auto modRange = iconBounds.getHeight() * 0.15f;
+    g.setColour(color.withAlpha(0.6f));
+    g.fillRoundedRectangle(sliderTrack.getCentreX() - trackThickness * 1.5f, thumbY - modRange * 0.5f,
+                          trackThickness * 3, modRange, trackThickness);
+}
+
 void FancyIconPack::drawModCurve(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
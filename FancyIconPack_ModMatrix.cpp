@@ -0,0 +1,171 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// LIVE MOD MATRIX IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr float depthSteps = 127.0f;
+
+    juce::int8 quantiseDepth(float depth) noexcept
+    {
+        return (juce::int8) juce::roundToInt(juce::jlimit(-1.0f, 1.0f, depth) * depthSteps);
+    }
+}
+
+FancyIconPack::LiveModMatrix::LiveModMatrix(int sources, int destinations)
+    : numSources(juce::jmax(1, sources)), numDestinations(juce::jmax(1, destinations))
+{
+    jassert(sources > 0 && destinations > 0);
+    cells.insertMultiple(0, 0, numSources * numDestinations);
+}
+
+void FancyIconPack::LiveModMatrix::setDepth(int source, int destination, float depth)
+{
+    jassert(juce::isPositiveAndBelow(source, numSources) && juce::isPositiveAndBelow(destination, numDestinations));
+
+    auto index = source * numDestinations + destination;
+    auto level = quantiseDepth(depth);
+
+    // Changes below the displayed resolution don't need a repaint
+    if (cells[index] != level)
+    {
+        cells.set(index, level);
+        dirty.setBit(index);
+    }
+}
+
+void FancyIconPack::LiveModMatrix::setDepths(const float* depths)
+{
+    for (int index = 0; index < cells.size(); ++index)
+    {
+        auto level = quantiseDepth(depths[index]);
+
+        if (cells[index] != level)
+        {
+            cells.set(index, level);
+            dirty.setBit(index);
+        }
+    }
+}
+
+float FancyIconPack::LiveModMatrix::getDepth(int source, int destination) const
+{
+    jassert(juce::isPositiveAndBelow(source, numSources) && juce::isPositiveAndBelow(destination, numDestinations));
+    return cells[source * numDestinations + destination] / depthSteps;
+}
+
+juce::Rectangle<float> FancyIconPack::LiveModMatrix::getCellBounds(juce::Rectangle<float> bounds, int source,
+                                                                   int destination) const
+{
+    auto cellWidth = bounds.getWidth() / (float) numDestinations;
+    auto cellHeight = bounds.getHeight() / (float) numSources;
+    auto gap = juce::jmin(1.0f, cellWidth * 0.1f, cellHeight * 0.1f);
+
+    return juce::Rectangle<float>(bounds.getX() + destination * cellWidth, bounds.getY() + source * cellHeight,
+                                  cellWidth, cellHeight).reduced(gap);
+}
+
+juce::RectangleList<int> FancyIconPack::LiveModMatrix::popDirtyRegion(juce::Rectangle<float> bounds)
+{
+    juce::RectangleList<int> region;
+
+    // Runs of neighbouring dirty cells in a row become one rectangle
+    for (auto index = dirty.findNextSetBit(0); index >= 0;)
+    {
+        auto source = index / numDestinations;
+        auto first = index % numDestinations;
+        auto last = first;
+
+        while (last + 1 < numDestinations && dirty[index + (last + 1 - first)])
+            ++last;
+
+        // One pixel of slack covers draw() snapping the matrix to whole physical pixels
+        region.add(getCellBounds(bounds, source, first).getUnion(getCellBounds(bounds, source, last))
+                       .getSmallestIntegerContainer().expanded(1));
+
+        index = dirty.findNextSetBit(index + (last - first) + 1);
+    }
+
+    dirty.clear();
+    return region;
+}
+
+void FancyIconPack::LiveModMatrix::updateFrame(juce::Rectangle<float> bounds, juce::Colour color, float scale)
+{
+    juce::Point<float> size(bounds.getWidth(), bounds.getHeight());
+
+    if (frame.isValid() && size == frameSize && scale == frameScale && color == frameColor)
+        return;
+
+    frameSize = size;
+    frameScale = scale;
+    frameColor = color;
+
+    frame = juce::Image(juce::Image::ARGB, juce::jmax(1, (int) std::ceil(size.x * scale)),
+                        juce::jmax(1, (int) std::ceil(size.y * scale)), true);
+
+    juce::Graphics g(frame);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
+    juce::Rectangle<float> area(size.x, size.y);
+    auto cellWidth = size.x / (float) numDestinations;
+    auto cellHeight = size.y / (float) numSources;
+    auto lineWidth = 1.0f / scale;
+
+    g.setColour(color.withAlpha(0.1f));
+    g.fillRect(area);
+
+    // Grid lines as in drawModMatrix, one physical pixel wide
+    g.setColour(color.withAlpha(0.4f));
+
+    for (int i = 0; i <= numDestinations; ++i)
+        g.fillRect(juce::jmin(i * cellWidth, size.x - lineWidth), 0.0f, lineWidth, size.y);
+
+    for (int i = 0; i <= numSources; ++i)
+        g.fillRect(0.0f, juce::jmin(i * cellHeight, size.y - lineWidth), size.x, lineWidth);
+}
+
+void FancyIconPack::LiveModMatrix::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    // Whole physical pixels, so the frame isn't resampled at fractional origins
+    // and the cells stay between its one-pixel grid lines
+    bounds.setPosition((bounds.getPosition() * scale).roundToInt().toFloat() / scale);
+    updateFrame(bounds, color, scale);
+
+    g.drawImageTransformed(frame, juce::AffineTransform::scale(1.0f / scale).translated(bounds.getPosition()));
+
+    // Only the cells under the clip region are visited
+    auto clip = g.getClipBounds().toFloat().getIntersection(bounds);
+
+    if (clip.isEmpty())
+        return;
+
+    auto cellWidth = bounds.getWidth() / (float) numDestinations;
+    auto cellHeight = bounds.getHeight() / (float) numSources;
+    auto firstColumn = juce::jlimit(0, numDestinations - 1, (int) ((clip.getX() - bounds.getX()) / cellWidth));
+    auto lastColumn = juce::jlimit(0, numDestinations - 1, (int) ((clip.getRight() - bounds.getX()) / cellWidth));
+    auto firstRow = juce::jlimit(0, numSources - 1, (int) ((clip.getY() - bounds.getY()) / cellHeight));
+    auto lastRow = juce::jlimit(0, numSources - 1, (int) ((clip.getBottom() - bounds.getY()) / cellHeight));
+
+    auto negativeColor = color.withRotatedHue(0.5f);
+
+    for (int source = firstRow; source <= lastRow; ++source)
+    {
+        for (int destination = firstColumn; destination <= lastColumn; ++destination)
+        {
+            auto level = cells[source * numDestinations + destination];
+
+            if (level == 0)
+                continue;
+
+            // Same alpha ramp as drawModMatrix's connection dots
+            auto depth = std::abs(level) / depthSteps;
+            g.setColour((level > 0 ? color : negativeColor).withAlpha(0.3f + depth * 0.5f));
+            g.fillRect(getCellBounds(bounds, source, destination));
+        }
+    }
+}
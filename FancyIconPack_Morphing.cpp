@@ -0,0 +1,444 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// ICON MORPHING IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr int minContourVertices = 8;
+    constexpr int maxContourVertices = 128;
+    constexpr size_t maxCachedMorphs = 64;
+
+    // Curve flattening tolerance in physical pixels
+    constexpr float flatteningTolerance = 0.2f;
+
+    struct Outline
+    {
+        juce::Array<juce::Point<float>> points;
+        juce::Point<float> centre;
+    };
+
+    struct FillShape
+    {
+        juce::Colour colour;
+        bool useNonZeroWinding;
+        juce::Array<Outline> outlines;
+        juce::Point<float> centre;
+    };
+
+    juce::Colour getFillColour(const juce::FillType& fill)
+    {
+        if (fill.isGradient())
+            return fill.gradient->getColourAtPosition(0.5).withMultipliedAlpha(fill.getOpacity());
+
+        return fill.colour;
+    }
+
+    float getColourDistance(juce::Colour a, juce::Colour b) noexcept
+    {
+        return (std::abs((int) a.getAlpha() - (int) b.getAlpha()) + std::abs((int) a.getRed() - (int) b.getRed())
+                + std::abs((int) a.getGreen() - (int) b.getGreen()) + std::abs((int) a.getBlue() - (int) b.getBlue()))
+               / (4.0f * 255.0f);
+    }
+
+    juce::Point<float> getCentre(const juce::Array<juce::Point<float>>& points) noexcept
+    {
+        juce::Point<float> sum;
+
+        for (auto& p : points)
+            sum += p;
+
+        return points.isEmpty() ? sum : sum / (float) points.size();
+    }
+
+    /** Flatten a recorded fill into closed outlines, one per subpath */
+    FillShape createFillShape(const juce::Path& path, juce::Colour colour, float tolerance)
+    {
+        FillShape shape { colour, path.isUsingNonZeroWinding(), {}, {} };
+        auto subPath = -1;
+
+        for (juce::PathFlatteningIterator it(path, {}, tolerance); it.next();)
+        {
+            if (it.subPathIndex != subPath)
+            {
+                subPath = it.subPathIndex;
+                shape.outlines.add({});
+                shape.outlines.getReference(shape.outlines.size() - 1).points.add({ it.x1, it.y1 });
+            }
+
+            shape.outlines.getReference(shape.outlines.size() - 1).points.add({ it.x2, it.y2 });
+        }
+
+        juce::Array<juce::Point<float>> allPoints;
+
+        for (int i = shape.outlines.size(); --i >= 0;)
+        {
+            auto& points = shape.outlines.getReference(i).points;
+
+            if (points.size() > 1 && points.getFirst() == points.getLast())
+                points.removeLast();
+
+            if (points.size() < 3)
+            {
+                shape.outlines.remove(i);
+                continue;
+            }
+
+            shape.outlines.getReference(i).centre = getCentre(points);
+            allPoints.addArray(points);
+        }
+
+        shape.centre = getCentre(allPoints);
+        return shape;
+    }
+
+    /** Record an icon and flatten every fill, or return false if it can't be interpolated */
+    bool extractShapes(FancyIconPack::IconId icon, juce::Point<float> size, juce::Colour color, float scale,
+                       juce::Array<FillShape>& shapes)
+    {
+        auto geometry = FancyIconPack::recordIcon(icon, { size.x, size.y }, color, scale);
+
+        if (! geometry.isComplete)
+            return false;
+
+        for (auto& op : geometry.ops)
+        {
+            juce::Path path;
+
+            switch (op.type)
+            {
+                case FancyIconPack::IconGeometry::Op::Type::path:      path = op.path; break;
+                case FancyIconPack::IconGeometry::Op::Type::rectangle: path.addRectangle(op.rectangle); break;
+                case FancyIconPack::IconGeometry::Op::Type::glyph:     return false;
+            }
+
+            auto shape = createFillShape(path, getFillColour(op.fill), flatteningTolerance / scale);
+
+            if (! shape.outlines.isEmpty())
+                shapes.add(std::move(shape));
+        }
+
+        return true;
+    }
+
+    /**
+     * Greedily pair items from two lists by ascending cost. Unpaired items get -1
+     * as their partner; pairs come back in the order of the first list, with
+     * items only in the second list after them.
+     */
+    template <typename CostFunction>
+    juce::Array<std::pair<int, int>> pairUp(int numA, int numB, CostFunction&& cost)
+    {
+        struct Candidate
+        {
+            float cost;
+            int a, b;
+        };
+
+        std::vector<Candidate> candidates;
+        candidates.reserve((size_t) (numA * numB));
+
+        for (int a = 0; a < numA; ++a)
+            for (int b = 0; b < numB; ++b)
+                candidates.push_back({ cost(a, b), a, b });
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const Candidate& x, const Candidate& y) { return x.cost < y.cost; });
+
+        std::vector<int> partnerOfA((size_t) numA, -1), partnerOfB((size_t) numB, -1);
+
+        for (auto& c : candidates)
+        {
+            if (partnerOfA[(size_t) c.a] < 0 && partnerOfB[(size_t) c.b] < 0)
+            {
+                partnerOfA[(size_t) c.a] = c.b;
+                partnerOfB[(size_t) c.b] = c.a;
+            }
+        }
+
+        juce::Array<std::pair<int, int>> pairs;
+
+        for (int a = 0; a < numA; ++a)
+            pairs.add({ a, partnerOfA[(size_t) a] });
+
+        for (int b = 0; b < numB; ++b)
+            if (partnerOfB[(size_t) b] < 0)
+                pairs.add({ -1, b });
+
+        return pairs;
+    }
+
+    /** Resample a closed outline to n points evenly spaced along its perimeter */
+    juce::Array<juce::Point<float>> resample(const juce::Array<juce::Point<float>>& points, int n)
+    {
+        auto numPoints = points.size();
+        auto perimeter = 0.0f;
+
+        for (int i = 0; i < numPoints; ++i)
+            perimeter += points.getReference(i).getDistanceFrom(points.getReference((i + 1) % numPoints));
+
+        juce::Array<juce::Point<float>> result;
+        auto step = perimeter / (float) n;
+        auto travelled = 0.0f;
+        auto segment = 0;
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto target = step * (float) i;
+
+            for (;;)
+            {
+                auto start = points.getReference(segment);
+                auto end = points.getReference((segment + 1) % numPoints);
+                auto length = start.getDistanceFrom(end);
+
+                if (travelled + length >= target || segment == numPoints - 1)
+                {
+                    auto t = length > 0.0f ? juce::jlimit(0.0f, 1.0f, (target - travelled) / length) : 0.0f;
+                    result.add(start + (end - start) * t);
+                    break;
+                }
+
+                travelled += length;
+                ++segment;
+            }
+        }
+
+        return result;
+    }
+
+    /** Rotate b so that its points line up with a as closely as possible */
+    juce::Array<juce::Point<float>> alignTo(const juce::Array<juce::Point<float>>& a,
+                                            const juce::Array<juce::Point<float>>& b)
+    {
+        auto n = a.size();
+        auto bestOffset = 0;
+        auto bestError = std::numeric_limits<float>::max();
+
+        for (int offset = 0; offset < n; ++offset)
+        {
+            auto error = 0.0f;
+
+            for (int i = 0; i < n && error < bestError; ++i)
+            {
+                auto d = a.getReference(i) - b.getReference((i + offset) % n);
+                error += d.x * d.x + d.y * d.y;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                bestOffset = offset;
+            }
+        }
+
+        juce::Array<juce::Point<float>> result;
+
+        for (int i = 0; i < n; ++i)
+            result.add(b.getReference((i + bestOffset) % n));
+
+        return result;
+    }
+
+    struct MorphKey
+    {
+        FancyIconPack::IconId from, to;
+        int width, height, scale;
+        juce::uint32 argb;
+
+        bool operator==(const MorphKey& other) const noexcept
+        {
+            return from == other.from && to == other.to && width == other.width && height == other.height
+                && scale == other.scale && argb == other.argb;
+        }
+    };
+
+    struct MorphCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<MorphKey, std::shared_ptr<const FancyIconPack::IconMorph>>> entries;
+    };
+}
+
+// ============================================================================
+// IconMorph
+// ============================================================================
+
+FancyIconPack::IconMorph::IconMorph(IconId from, IconId to, juce::Point<float> iconSize, juce::Colour iconColor,
+                                    float physicalPixelScale)
+    : fromIcon(from), toIcon(to), size(iconSize), color(iconColor)
+{
+    juce::Array<FillShape> fromShapes, toShapes;
+
+    interpolates = extractShapes(from, size, color, physicalPixelScale, fromShapes)
+                && extractShapes(to, size, color, physicalPixelScale, toShapes);
+
+    if (! interpolates)
+        return;
+
+    auto diagonal = juce::jmax(1.0f, size.getDistanceFromOrigin());
+
+    auto shapePairs = pairUp(fromShapes.size(), toShapes.size(), [&](int a, int b)
+    {
+        auto& x = fromShapes.getReference(a);
+        auto& y = toShapes.getReference(b);
+        return x.centre.getDistanceFrom(y.centre) / diagonal + getColourDistance(x.colour, y.colour);
+    });
+
+    for (auto& shapePair : shapePairs)
+    {
+        auto* fromShape = shapePair.first >= 0 ? &fromShapes.getReference(shapePair.first) : nullptr;
+        auto* toShape = shapePair.second >= 0 ? &toShapes.getReference(shapePair.second) : nullptr;
+
+        // A fill without a partner fades out in place
+        Shape shape;
+        shape.fromColour = fromShape != nullptr ? fromShape->colour : toShape->colour.withAlpha((juce::uint8) 0);
+        shape.toColour = toShape != nullptr ? toShape->colour : fromShape->colour.withAlpha((juce::uint8) 0);
+        shape.useNonZeroWinding = (fromShape != nullptr ? fromShape : toShape)->useNonZeroWinding;
+        shape.firstContour = contours.size();
+
+        juce::Array<Outline> noOutlines;
+        auto& fromOutlines = fromShape != nullptr ? fromShape->outlines : noOutlines;
+        auto& toOutlines = toShape != nullptr ? toShape->outlines : noOutlines;
+
+        auto outlinePairs = pairUp(fromOutlines.size(), toOutlines.size(), [&](int a, int b)
+        {
+            return fromOutlines.getReference(a).centre.getDistanceFrom(toOutlines.getReference(b).centre);
+        });
+
+        for (auto& outlinePair : outlinePairs)
+        {
+            auto* a = outlinePair.first >= 0 ? &fromOutlines.getReference(outlinePair.first) : nullptr;
+            auto* b = outlinePair.second >= 0 ? &toOutlines.getReference(outlinePair.second) : nullptr;
+
+            auto n = juce::jlimit(minContourVertices, maxContourVertices,
+                                  juce::jmax(a != nullptr ? a->points.size() : 0, b != nullptr ? b->points.size() : 0));
+
+            // An outline without a partner shrinks to (or grows from) its centre
+            juce::Array<juce::Point<float>> fromVertices, toVertices;
+
+            if (a != nullptr)
+                fromVertices = resample(a->points, n);
+            else
+                fromVertices.insertMultiple(0, b->centre, n);
+
+            if (b != nullptr)
+                toVertices = a != nullptr ? alignTo(fromVertices, resample(b->points, n)) : resample(b->points, n);
+            else
+                toVertices.insertMultiple(0, a->centre, n);
+
+            contours.add({ fromPoints.size(), n });
+            fromPoints.addArray(fromVertices);
+            toPoints.addArray(toVertices);
+        }
+
+        shape.numContours = contours.size() - shape.firstContour;
+
+        if (shape.numContours > 0)
+            shapes.add(shape);
+    }
+}
+
+std::shared_ptr<const FancyIconPack::IconMorph>
+FancyIconPack::IconMorph::getCached(IconId from, IconId to, juce::Point<float> iconSize, juce::Colour iconColor,
+                                    float physicalPixelScale)
+{
+    static MorphCache cache;
+
+    MorphKey key { from, to,
+                   juce::roundToInt(iconSize.x * 64.0f),
+                   juce::roundToInt(iconSize.y * 64.0f),
+                   juce::roundToInt(physicalPixelScale * 64.0f),
+                   iconColor.getARGB() };
+
+    const juce::ScopedLock sl(cache.lock);
+
+    for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+    {
+        if (it->first == key)
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+            return it->second;
+        }
+    }
+
+    auto morph = std::make_shared<const IconMorph>(from, to, iconSize, iconColor, physicalPixelScale);
+    cache.entries.emplace_front(key, morph);
+
+    if (cache.entries.size() > maxCachedMorphs)
+        cache.entries.pop_back();
+
+    return morph;
+}
+
+void FancyIconPack::IconMorph::draw(juce::Graphics& g, juce::Point<float> origin, float position) const
+{
+    position = juce::jlimit(0.0f, 1.0f, position);
+
+    if (! interpolates)
+    {
+        juce::Rectangle<float> bounds(origin.x, origin.y, size.x, size.y);
+
+        g.beginTransparencyLayer(1.0f - position);
+        drawIcon(g, fromIcon, bounds, color);
+        g.endTransparencyLayer();
+
+        g.beginTransparencyLayer(position);
+        drawIcon(g, toIcon, bounds, color);
+        g.endTransparencyLayer();
+        return;
+    }
+
+    // Reused across frames so its storage is only allocated once per thread
+    static thread_local juce::Path path;
+
+    for (auto& shape : shapes)
+    {
+        path.clear();
+        path.setUsingNonZeroWinding(shape.useNonZeroWinding);
+
+        for (int c = shape.firstContour; c < shape.firstContour + shape.numContours; ++c)
+        {
+            auto& contour = contours.getReference(c);
+
+            for (int i = contour.firstVertex; i < contour.firstVertex + contour.numVertices; ++i)
+            {
+                auto from = fromPoints.getReference(i);
+                auto p = origin + from + (toPoints.getReference(i) - from) * position;
+
+                if (i == contour.firstVertex)
+                    path.startNewSubPath(p);
+                else
+                    path.lineTo(p);
+            }
+
+            path.closeSubPath();
+        }
+
+        g.setColour(shape.fromColour.interpolatedWith(shape.toColour, position));
+        g.fillPath(path);
+    }
+}
+
+void FancyIconPack::drawMorph(juce::Graphics& g, IconId from, IconId to, juce::Rectangle<float> bounds,
+                              juce::Colour color, float position)
+{
+    if (position <= 0.0f)
+    {
+        drawIcon(g, from, bounds, color);
+        return;
+    }
+
+    if (position >= 1.0f)
+    {
+        drawIcon(g, to, bounds, color);
+        return;
+    }
+
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    IconMorph::getCached(from, to, { bounds.getWidth(), bounds.getHeight() }, color, scale)
+        ->draw(g, bounds.getPosition(), position);
+}
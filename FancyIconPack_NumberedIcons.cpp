@@ -0,0 +1,290 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// NUMBERED MODULES IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr size_t maxCachedStrips = 32;
+    constexpr size_t maxCachedBases = 32;
+
+    // Room around each glyph and base raster for antialiasing and strokes that straddle the edge, in logical pixels
+    constexpr float glyphMargin = 1.0f;
+    constexpr float baseMargin = 2.0f;
+
+    // Share of the icon height above the label row
+    constexpr float baseHeightRatio = 0.6f;
+
+    struct StripKey
+    {
+        juce::String labels;
+        int fontHeight, scale;
+
+        bool operator==(const StripKey& other) const noexcept
+        {
+            return fontHeight == other.fontHeight && scale == other.scale && labels == other.labels;
+        }
+    };
+
+    struct StripCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<StripKey, std::shared_ptr<const FancyIconPack::GlyphStrip>>> entries;
+    };
+
+    struct BaseKey
+    {
+        FancyIconPack::DrawFunction draw;
+        int width, height, scale;
+
+        bool operator==(const BaseKey& other) const noexcept
+        {
+            return draw == other.draw && width == other.width && height == other.height && scale == other.scale;
+        }
+    };
+
+    struct BaseCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<BaseKey, std::shared_ptr<const juce::Image>>> entries;
+    };
+
+    float getBaseMarginPixels(float physicalPixelScale) noexcept
+    {
+        return std::ceil(baseMargin * physicalPixelScale);
+    }
+
+    /** The glyph drawn in white into an alpha mask, so any color can tint it */
+    std::shared_ptr<const juce::Image> renderBase(FancyIconPack::DrawFunction draw, juce::Point<float> size,
+                                                  float physicalPixelScale)
+    {
+        auto marginPixels = getBaseMarginPixels(physicalPixelScale);
+        auto width = juce::jmax(1, (int) std::ceil(size.x * physicalPixelScale + marginPixels * 2.0f));
+        auto height = juce::jmax(1, (int) std::ceil(size.y * physicalPixelScale + marginPixels * 2.0f));
+
+        auto image = std::make_shared<juce::Image>(juce::Image::SingleChannel, width, height, true);
+
+        juce::Graphics g(*image);
+        g.addTransform(juce::AffineTransform::scale(physicalPixelScale).translated(marginPixels, marginPixels));
+        draw(g, { 0.0f, 0.0f, size.x, size.y }, juce::Colours::white);
+
+        return image;
+    }
+
+    std::shared_ptr<const juce::Image> getCachedBase(FancyIconPack::DrawFunction draw, juce::Point<float> size,
+                                                     float physicalPixelScale)
+    {
+        static BaseCache cache;
+
+        BaseKey key { draw,
+                      juce::roundToInt(size.x * 64.0f),
+                      juce::roundToInt(size.y * 64.0f),
+                      juce::roundToInt(physicalPixelScale * 64.0f) };
+
+        const juce::ScopedLock sl(cache.lock);
+
+        for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+        {
+            if (it->first == key)
+            {
+                cache.entries.splice(cache.entries.begin(), cache.entries, it);
+                return it->second;
+            }
+        }
+
+        auto image = renderBase(draw, size, physicalPixelScale);
+        cache.entries.emplace_front(key, image);
+
+        if (cache.entries.size() > maxCachedBases)
+            cache.entries.pop_back();
+
+        return image;
+    }
+}
+
+// ============================================================================
+// GlyphStrip
+// ============================================================================
+
+FancyIconPack::GlyphStrip::GlyphStrip(const juce::StringArray& labels, float fontHeight, float physicalPixelScale)
+    : scale(physicalPixelScale)
+{
+    juce::Font font(fontHeight, juce::Font::bold);
+
+    // Whole physical pixels, so glyphs keep the pixel grid they were rasterised on
+    auto marginPixels = std::ceil(glyphMargin * scale);
+    padding = marginPixels / scale;
+
+    auto cellHeight = juce::jmax(1, (int) std::ceil(fontHeight * scale + marginPixels * 2.0f));
+    juce::Array<int> cellWidths;
+    auto stripWidth = 0;
+
+    for (auto& label : labels)
+    {
+        auto advance = font.getStringWidthFloat(label);
+        advances.add(advance);
+        cellWidths.add(juce::jmax(1, (int) std::ceil(advance * scale + marginPixels * 2.0f)));
+        stripWidth += cellWidths.getLast();
+    }
+
+    strip = juce::Image(juce::Image::SingleChannel, juce::jmax(1, stripWidth), cellHeight, true);
+
+    {
+        juce::Graphics g(strip);
+        g.setColour(juce::Colours::white);
+        g.setFont(font);
+
+        for (int i = 0, x = 0; i < labels.size(); x += cellWidths[i++])
+        {
+            juce::Graphics::ScopedSaveState state(g);
+            g.reduceClipRegion(x, 0, cellWidths[i], cellHeight);
+            g.addTransform(juce::AffineTransform::scale(scale).translated((float) x + marginPixels, marginPixels));
+            g.drawText(labels[i], juce::Rectangle<float>(0.0f, 0.0f, advances[i], fontHeight),
+                       juce::Justification::centredLeft, false);
+        }
+    }
+
+    // Glyphs share the strip's pixels
+    for (int i = 0, x = 0; i < labels.size(); x += cellWidths[i++])
+        glyphs.add(strip.getClippedImage({ x, 0, cellWidths[i], cellHeight }));
+}
+
+std::shared_ptr<const FancyIconPack::GlyphStrip>
+FancyIconPack::GlyphStrip::getCached(const juce::StringArray& labels, float fontHeight, float physicalPixelScale)
+{
+    static StripCache cache;
+
+    StripKey key { labels.joinIntoString("\n"),
+                   juce::roundToInt(fontHeight * 64.0f),
+                   juce::roundToInt(physicalPixelScale * 64.0f) };
+
+    const juce::ScopedLock sl(cache.lock);
+
+    for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+    {
+        if (it->first == key)
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+            return it->second;
+        }
+    }
+
+    auto strip = std::make_shared<const GlyphStrip>(labels, fontHeight, physicalPixelScale);
+    cache.entries.emplace_front(key, strip);
+
+    if (cache.entries.size() > maxCachedStrips)
+        cache.entries.pop_back();
+
+    return strip;
+}
+
+std::shared_ptr<const FancyIconPack::GlyphStrip> FancyIconPack::GlyphStrip::getNumerals(float fontHeight,
+                                                                                        float physicalPixelScale)
+{
+    static const juce::StringArray digits { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" };
+    return getCached(digits, fontHeight, physicalPixelScale);
+}
+
+size_t FancyIconPack::GlyphStrip::getMemoryUsage() const noexcept
+{
+    return (size_t) strip.getWidth() * (size_t) strip.getHeight();
+}
+
+void FancyIconPack::GlyphStrip::draw(juce::Graphics& g, int index, juce::Point<float> position) const
+{
+    jassert(juce::isPositiveAndBelow(index, glyphs.size()));
+
+    auto origin = (position * scale).roundToInt().toFloat() / scale - juce::Point<float>(padding, padding);
+    g.drawImageTransformed(glyphs.getReference(index), juce::AffineTransform::scale(1.0f / scale).translated(origin),
+                           true);
+}
+
+// ============================================================================
+// NumberedIcon
+// ============================================================================
+
+FancyIconPack::NumberedIcon::NumberedIcon(DrawFunction baseToDraw, const juce::String& labelPrefix, float labelFontRatio)
+    : base(baseToDraw), prefix(labelPrefix), fontRatio(labelFontRatio)
+{
+    jassert(base != nullptr);
+}
+
+void FancyIconPack::NumberedIcon::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, int number)
+{
+    jassert(number >= 0);
+
+    auto currentScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    juce::Point<float> currentSize(bounds.getWidth(), bounds.getHeight());
+    auto labelArea = bounds.withTrimmedTop(bounds.getHeight() * baseHeightRatio);
+    auto fontHeight = labelArea.getHeight() * fontRatio;
+
+    if (baseMask == nullptr || currentSize != size || currentScale != scale)
+    {
+        size = currentSize;
+        scale = currentScale;
+        baseMask = getCachedBase(base, size, scale);
+        prefixGlyph = prefix.isNotEmpty() ? GlyphStrip::getCached({ prefix }, fontHeight, scale) : nullptr;
+        numerals = GlyphStrip::getNumerals(fontHeight, scale);
+    }
+
+    g.setColour(color);
+
+    // The mask is rendered with an opaque color, so parts a base draws with an
+    // absolute alpha (drawLFOBase's arrows) would be scaled by a translucent
+    // color's alpha a second time; draw those bases live instead
+    if (color.isOpaque())
+    {
+        // Whole physical pixels, as for the glyphs, so the mask isn't resampled
+        auto origin = (bounds.getPosition() * scale).roundToInt().toFloat() / scale;
+        auto margin = getBaseMarginPixels(scale) / scale;
+        g.drawImageTransformed(*baseMask,
+                               juce::AffineTransform::scale(1.0f / scale)
+                                   .translated(origin.x - margin, origin.y - margin),
+                               true);
+    }
+    else
+    {
+        base(g, bounds, color);
+        g.setColour(color);
+    }
+
+    // Label centred in its row, as drawText would place the whole string
+    auto digits = juce::String(juce::jmax(0, number));
+    auto width = prefixGlyph != nullptr ? prefixGlyph->getAdvance(0) : 0.0f;
+
+    for (int i = 0; i < digits.length(); ++i)
+        width += numerals->getAdvance((int) (digits[i] - '0'));
+
+    juce::Point<float> position(labelArea.getCentreX() - width * 0.5f, labelArea.getCentreY() - fontHeight * 0.5f);
+
+    if (prefixGlyph != nullptr)
+    {
+        prefixGlyph->draw(g, 0, position);
+        position.x += prefixGlyph->getAdvance(0);
+    }
+
+    for (int i = 0; i < digits.length(); ++i)
+    {
+        auto index = (int) (digits[i] - '0');
+        numerals->draw(g, index, position);
+        position.x += numerals->getAdvance(index);
+    }
+}
+
+size_t FancyIconPack::NumberedIcon::getMemoryUsage() const noexcept
+{
+    auto total = baseMask != nullptr ? (size_t) baseMask->getWidth() * (size_t) baseMask->getHeight() : 0;
+
+    if (prefixGlyph != nullptr)
+        total += prefixGlyph->getMemoryUsage();
+
+    if (numerals != nullptr)
+        total += numerals->getMemoryUsage();
+
+    return total;
+}
@@ -0,0 +1,265 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// PATCH CABLES IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    // Flattened length per straight segment, in pixels
+    constexpr float segmentLength = 6.0f;
+    constexpr int minSegments = 4, maxSegments = 48;
+}
+
+FancyIconPack::PatchCables::PatchCables(float cableThickness, float cableSlack, int gridCellSize)
+    : thickness(cableThickness), slack(cableSlack), cellSize(juce::jmax(8, gridCellSize))
+{
+}
+
+int FancyIconPack::PatchCables::addCable(juce::Point<float> start, juce::Point<float> end, juce::Colour color)
+{
+    int cableId;
+
+    if (! freeSlots.isEmpty())
+    {
+        cableId = freeSlots.getLast();
+        freeSlots.removeLast();
+    }
+    else
+    {
+        cableId = flags.size();
+
+        for (auto* column : { &x0, &y0, &x1, &y1, &x2, &y2, &x3, &y3 })
+            column->add(0.0f);
+
+        colours.add({});
+        bounds.add({});
+        outlines.add({});
+        flags.add(0);
+        drawStamps.add(0);
+    }
+
+    colours.set(cableId, color);
+    flags.set(cableId, alive | outlineStale);
+    setControlPoints(cableId, start, end);
+    updateBounds(cableId);
+    addToGrid(cableId);
+    ++numCables;
+
+    return cableId;
+}
+
+void FancyIconPack::PatchCables::removeCable(int cableId)
+{
+    jassert(juce::isPositiveAndBelow(cableId, flags.size()) && (flags[cableId] & alive) != 0);
+
+    removeFromGrid(cableId);
+    flags.set(cableId, 0);
+    outlines.getReference(cableId).clear();
+    freeSlots.add(cableId);
+    --numCables;
+}
+
+void FancyIconPack::PatchCables::clear()
+{
+    for (auto* column : { &x0, &y0, &x1, &y1, &x2, &y2, &x3, &y3 })
+        column->clearQuick();
+
+    colours.clearQuick();
+    bounds.clearQuick();
+    outlines.clear();
+    flags.clearQuick();
+    drawStamps.clearQuick();
+    freeSlots.clearQuick();
+    grid.clear();
+    numCables = 0;
+}
+
+juce::Rectangle<int> FancyIconPack::PatchCables::setEndpoints(int cableId, juce::Point<float> start,
+                                                              juce::Point<float> end)
+{
+    jassert(juce::isPositiveAndBelow(cableId, flags.size()) && (flags[cableId] & alive) != 0);
+
+    if (start == juce::Point<float>(x0[cableId], y0[cableId]) && end == juce::Point<float>(x3[cableId], y3[cableId]))
+        return {};
+
+    auto before = bounds[cableId];
+
+    removeFromGrid(cableId);
+    setControlPoints(cableId, start, end);
+    updateBounds(cableId);
+    addToGrid(cableId);
+    flags.set(cableId, flags[cableId] | outlineStale);
+
+    return before.getUnion(bounds[cableId]).getSmallestIntegerContainer();
+}
+
+juce::Rectangle<int> FancyIconPack::PatchCables::setColour(int cableId, juce::Colour color)
+{
+    jassert(juce::isPositiveAndBelow(cableId, flags.size()) && (flags[cableId] & alive) != 0);
+
+    if (colours[cableId] == color)
+        return {};
+
+    colours.set(cableId, color);
+    return bounds[cableId].getSmallestIntegerContainer();
+}
+
+juce::Rectangle<float> FancyIconPack::PatchCables::getCableBounds(int cableId) const
+{
+    jassert(juce::isPositiveAndBelow(cableId, flags.size()));
+    return bounds[cableId];
+}
+
+void FancyIconPack::PatchCables::setControlPoints(int cableId, juce::Point<float> start, juce::Point<float> end)
+{
+    // Both handles hang below the jacks, like a cable under its own weight,
+    // and pull inwards a quarter of the way as drawPatchCable's do
+    auto sag = start.getDistanceFrom(end) * slack;
+    auto handle = (end.x - start.x) * 0.25f;
+
+    x0.set(cableId, start.x);          y0.set(cableId, start.y);
+    x1.set(cableId, start.x + handle); y1.set(cableId, start.y + sag);
+    x2.set(cableId, end.x - handle);   y2.set(cableId, end.y + sag);
+    x3.set(cableId, end.x);            y3.set(cableId, end.y);
+}
+
+void FancyIconPack::PatchCables::updateBounds(int cableId)
+{
+    // A cubic stays inside the hull of its control points
+    auto left = juce::jmin(juce::jmin(x0[cableId], x1[cableId]), juce::jmin(x2[cableId], x3[cableId]));
+    auto right = juce::jmax(juce::jmax(x0[cableId], x1[cableId]), juce::jmax(x2[cableId], x3[cableId]));
+    auto top = juce::jmin(juce::jmin(y0[cableId], y1[cableId]), juce::jmin(y2[cableId], y3[cableId]));
+    auto bottom = juce::jmax(juce::jmax(y0[cableId], y1[cableId]), juce::jmax(y2[cableId], y3[cableId]));
+
+    bounds.set(cableId, juce::Rectangle<float>::leftTopRightBottom(left, top, right, bottom)
+                            .expanded(thickness * 0.5f + 1.0f));
+}
+
+juce::Range<int> FancyIconPack::PatchCables::getCellRange(float start, float end) const noexcept
+{
+    return { (int) std::floor(start / (float) cellSize), (int) std::floor(end / (float) cellSize) + 1 };
+}
+
+void FancyIconPack::PatchCables::addToGrid(int cableId)
+{
+    auto area = bounds[cableId];
+    auto columns = getCellRange(area.getX(), area.getRight());
+    auto rows = getCellRange(area.getY(), area.getBottom());
+
+    for (int x = columns.getStart(); x < columns.getEnd(); ++x)
+        for (int y = rows.getStart(); y < rows.getEnd(); ++y)
+            grid[getCellKey(x, y)].add(cableId);
+}
+
+void FancyIconPack::PatchCables::removeFromGrid(int cableId)
+{
+    auto area = bounds[cableId];
+    auto columns = getCellRange(area.getX(), area.getRight());
+    auto rows = getCellRange(area.getY(), area.getBottom());
+
+    for (int x = columns.getStart(); x < columns.getEnd(); ++x)
+    {
+        for (int y = rows.getStart(); y < rows.getEnd(); ++y)
+        {
+            auto cell = grid.find(getCellKey(x, y));
+
+            if (cell != grid.end())
+                cell->second.removeFirstMatchingValue(cableId);
+        }
+    }
+}
+
+void FancyIconPack::PatchCables::updateOutline(int cableId)
+{
+    juce::Point<float> p0(x0[cableId], y0[cableId]), p1(x1[cableId], y1[cableId]),
+                       p2(x2[cableId], y2[cableId]), p3(x3[cableId], y3[cableId]);
+
+    // The control polygon's length bounds the curve's, so it sets the segment count
+    auto length = p0.getDistanceFrom(p1) + p1.getDistanceFrom(p2) + p2.getDistanceFrom(p3);
+    auto numSegments = juce::jlimit(minSegments, maxSegments, (int) (length / segmentLength));
+
+    juce::Path centreLine;
+    centreLine.preallocateSpace(numSegments * 3 + 3);
+    centreLine.startNewSubPath(p0);
+
+    for (int i = 1; i <= numSegments; ++i)
+    {
+        auto t = i / (float) numSegments;
+        auto u = 1.0f - t;
+        centreLine.lineTo(p0 * (u * u * u) + p1 * (3.0f * u * u * t) + p2 * (3.0f * u * t * t) + p3 * (t * t * t));
+    }
+
+    auto& outline = outlines.getReference(cableId);
+    outline.clear();
+    createStroke(thickness).createStrokedPath(outline, centreLine);
+
+    flags.set(cableId, flags[cableId] & ~outlineStale);
+}
+
+void FancyIconPack::PatchCables::draw(juce::Graphics& g)
+{
+    auto clip = g.getClipBounds().toFloat();
+    auto columns = getCellRange(clip.getX(), clip.getRight());
+    auto rows = getCellRange(clip.getY(), clip.getBottom());
+
+    visible.clearQuick();
+    ++currentStamp;
+
+    auto collect = [this, clip](int cableId)
+    {
+        if (drawStamps[cableId] != currentStamp && bounds[cableId].intersects(clip))
+        {
+            drawStamps.set(cableId, currentStamp);
+            visible.add(cableId);
+        }
+    };
+
+    // Large clip regions touch more cells than there are cables, so just scan the cables
+    if ((juce::int64) columns.getLength() * rows.getLength() > (juce::int64) numCables)
+    {
+        for (int i = 0; i < flags.size(); ++i)
+            if ((flags[i] & alive) != 0)
+                collect(i);
+    }
+    else
+    {
+        for (int x = columns.getStart(); x < columns.getEnd(); ++x)
+        {
+            for (int y = rows.getStart(); y < rows.getEnd(); ++y)
+            {
+                auto cell = grid.find(getCellKey(x, y));
+
+                if (cell != grid.end())
+                    for (auto cableId : cell->second)
+                        collect(cableId);
+            }
+        }
+    }
+
+    // Same colors next to each other, with ids breaking ties so overlaps draw in a stable order
+    std::sort(visible.begin(), visible.end(), [this](int a, int b)
+    {
+        auto argbA = colours[a].getARGB(), argbB = colours[b].getARGB();
+        return argbA != argbB ? argbA < argbB : a < b;
+    });
+
+    for (int i = 0; i < visible.size();)
+    {
+        auto color = colours[visible[i]];
+        batch.clear();
+
+        for (; i < visible.size() && colours[visible[i]] == color; ++i)
+        {
+            auto cableId = visible[i];
+
+            if ((flags[cableId] & outlineStale) != 0)
+                updateOutline(cableId);
+
+            batch.addPath(outlines.getReference(cableId));
+        }
+
+        g.setColour(color);
+        g.fillPath(batch);
+    }
+}
@@ -0,0 +1,362 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// GEOMETRY RECORDING IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    /**
+     * A LowLevelGraphicsContext that stores every fill instead of rasterising it.
+     * juce::Graphics expands strokes, lines, ellipses and rounded rectangles into
+     * outline paths before they reach the context, so each recorded op is a plain
+     * fill with the exact caps and joins the icon asked for.
+     *
+     * Strokes are told apart from fills by how they arrive: strokePath() asks for
+     * the physical pixel scale right before filling the stroked outline, drawLine()
+     * with a thickness fills a one-rectangle addLineSegment() path (a hand-built
+     * Path::addRectangle() fill looks the same and counts too), and drawRect()
+     * with a thickness sends its four edges as one rectangle list. Every other
+     * call drops a pending stroke, so an empty stroke can't mislabel the next fill.
+     */
+    class RecordingContext final : public juce::LowLevelGraphicsContext
+    {
+    public:
+        RecordingContext(FancyIconPack::IconGeometry& target, float scale)
+            : geometry(target), pixelScale(scale)
+        {
+        }
+
+        bool isVectorDevice() const override { return false; }
+
+        void setOrigin(juce::Point<int> o) override
+        {
+            strokePending = false;
+            state.transform = juce::AffineTransform::translation((float) o.x, (float) o.y).followedBy(state.transform);
+            ++geometry.numStateChanges;
+        }
+
+        void addTransform(const juce::AffineTransform& t) override
+        {
+            strokePending = false;
+            state.transform = t.followedBy(state.transform);
+            ++geometry.numStateChanges;
+        }
+
+        float getPhysicalPixelScaleFactor() override
+        {
+            // Graphics only asks for this when handing a path to the stroker, so
+            // the next fill is the stroked outline
+            strokePending = true;
+            return pixelScale * state.transform.getScaleFactor();
+        }
+
+        // Clipping can't be replayed as plain fills, so any use of it marks the
+        // recording incomplete and callers fall back to a live draw
+        bool clipToRectangle(const juce::Rectangle<int>&) override               { markIncomplete(); return true; }
+        bool clipToRectangleList(const juce::RectangleList<int>&) override       { markIncomplete(); return true; }
+        void excludeClipRectangle(const juce::Rectangle<int>&) override          { markIncomplete(); }
+        void clipToPath(const juce::Path&, const juce::AffineTransform&) override { markIncomplete(); }
+        void clipToImageAlpha(const juce::Image&, const juce::AffineTransform&) override { markIncomplete(); }
+
+        // Queries Graphics makes between the scale request and the fill; they don't end a pending stroke
+
+        bool clipRegionIntersects(const juce::Rectangle<int>&) override { return true; }
+        juce::Rectangle<int> getClipBounds() const override { return { -(1 << 24), -(1 << 24), 1 << 25, 1 << 25 }; }
+        bool isClipEmpty() const override { return false; }
+
+        void saveState() override
+        {
+            strokePending = false;
+            stack.add(state);
+            ++geometry.numStateChanges;
+        }
+
+        void restoreState() override
+        {
+            strokePending = false;
+
+            if (! stack.isEmpty())
+            {
+                state = stack.getLast();
+                stack.removeLast();
+                ++geometry.numStateChanges;
+            }
+        }
+
+        void beginTransparencyLayer(float) override { markIncomplete(); }
+        void endTransparencyLayer() override { strokePending = false; }
+
+        void setFill(const juce::FillType& fill) override
+        {
+            strokePending = false;
+
+            if (fill != state.fill)
+            {
+                state.fill = fill;
+                ++geometry.numStateChanges;
+            }
+        }
+
+        void setOpacity(float opacity) override
+        {
+            strokePending = false;
+            state.fill.setOpacity(opacity);
+            ++geometry.numStateChanges;
+        }
+        void setInterpolationQuality(juce::Graphics::ResamplingQuality) override { strokePending = false; }
+
+        void fillRect(const juce::Rectangle<int>& r, bool) override { addRectangle(r.toFloat(), false); }
+        void fillRect(const juce::Rectangle<float>& r) override     { addRectangle(r, false); }
+
+        // Only drawRect() with a thickness sends a rectangle list; the icons never call fillRectList()
+        void fillRectList(const juce::RectangleList<float>& list) override
+        {
+            for (auto& r : list)
+                addRectangle(r, true);
+        }
+
+        void fillPath(const juce::Path& path, const juce::AffineTransform& t) override
+        {
+            addPath(path, t, strokePending || isLineSegment(path));
+        }
+
+        void drawImage(const juce::Image&, const juce::AffineTransform&) override { markIncomplete(); }
+
+        // A hairline from Graphics::drawLine() without a thickness
+        void drawLine(const juce::Line<float>& line) override
+        {
+            juce::Path p;
+            p.addLineSegment(line, 1.0f);
+            addPath(p, {}, true);
+        }
+
+        void setFont(const juce::Font& f) override
+        {
+            strokePending = false;
+
+            if (f != state.font)
+            {
+                state.font = f;
+                ++geometry.numStateChanges;
+            }
+        }
+        const juce::Font& getFont() override       { return state.font; }
+
+       #if JUCE_MAJOR_VERSION >= 8
+        void drawGlyphs(juce::Span<const juce::uint16> glyphs,
+                        juce::Span<const juce::Point<float>> positions,
+                        const juce::AffineTransform& t) override
+        {
+            for (size_t i = 0; i < glyphs.size(); ++i)
+                addGlyph((int) glyphs[i], juce::AffineTransform::translation(positions[i]).followedBy(t));
+        }
+
+        uint64_t getFrameId() const override { return 0; }
+       #else
+        void drawGlyph(int glyphNumber, const juce::AffineTransform& t) override
+        {
+            addGlyph(glyphNumber, t);
+        }
+       #endif
+
+    private:
+        struct State
+        {
+            juce::AffineTransform transform;
+            juce::FillType fill;
+            juce::Font font;
+        };
+
+        /** Path::addLineSegment() output: one closed subpath of four corners at right angles */
+        static bool isLineSegment(const juce::Path& path)
+        {
+            juce::Point<float> corners[4];
+            auto numCorners = 0;
+            auto closed = false;
+
+            for (juce::Path::Iterator it(path); it.next();)
+            {
+                auto isCorner = (it.elementType == juce::Path::Iterator::startNewSubPath && numCorners == 0)
+                             || (it.elementType == juce::Path::Iterator::lineTo && numCorners > 0);
+
+                if (it.elementType == juce::Path::Iterator::closePath && numCorners == 4 && ! closed)
+                    closed = true;
+                else if (! isCorner || closed || numCorners == 4)
+                    return false;
+                else
+                    corners[numCorners++] = { it.x1, it.y1 };
+            }
+
+            if (! closed)
+                return false;
+
+            for (int i = 0; i < 4; ++i)
+            {
+                auto a = corners[(i + 1) % 4] - corners[i];
+                auto b = corners[(i + 2) % 4] - corners[(i + 1) % 4];
+
+                if (std::abs(a.x * b.x + a.y * b.y) > 1.0e-3f * (a.getDistanceFromOrigin() * b.getDistanceFromOrigin() + 1.0e-6f))
+                    return false;
+            }
+
+            return true;
+        }
+
+        void markIncomplete()
+        {
+            strokePending = false;
+            geometry.isComplete = false;
+        }
+
+        void addPath(const juce::Path& path, const juce::AffineTransform& t, bool isStroke)
+        {
+            strokePending = false;
+
+            FancyIconPack::IconGeometry::Op op;
+            op.fill = state.fill;
+            op.path = path;
+            op.path.applyTransform(t.followedBy(state.transform));
+            op.isStroke = isStroke;
+            geometry.ops.add(std::move(op));
+        }
+
+        void addRectangle(juce::Rectangle<float> r, bool isStroke)
+        {
+            strokePending = false;
+
+            if (! state.transform.isOnlyTranslation())
+            {
+                juce::Path p;
+                p.addRectangle(r);
+                addPath(p, {}, isStroke);
+                return;
+            }
+
+            FancyIconPack::IconGeometry::Op op;
+            op.type = FancyIconPack::IconGeometry::Op::Type::rectangle;
+            op.fill = state.fill;
+            op.rectangle = r.translated(state.transform.getTranslationX(), state.transform.getTranslationY());
+            op.isStroke = isStroke;
+            geometry.ops.add(std::move(op));
+        }
+
+        void addGlyph(int glyphNumber, const juce::AffineTransform& t)
+        {
+            strokePending = false;
+
+            FancyIconPack::IconGeometry::Op op;
+            op.type = FancyIconPack::IconGeometry::Op::Type::glyph;
+            op.fill = state.fill;
+            op.glyph = glyphNumber;
+            op.font = state.font;
+            op.glyphTransform = t.followedBy(state.transform);
+            geometry.ops.add(std::move(op));
+        }
+
+        FancyIconPack::IconGeometry& geometry;
+        float pixelScale;
+        bool strokePending = false;
+        State state;
+        juce::Array<State> stack;
+
+        JUCE_DECLARE_NON_COPYABLE(RecordingContext)
+    };
+
+    size_t getPathMemoryUsage(const juce::Path& path) noexcept
+    {
+        size_t numFloats = 0;
+
+        for (juce::Path::Iterator it(path); it.next();)
+        {
+            switch (it.elementType)
+            {
+                case juce::Path::Iterator::startNewSubPath:
+                case juce::Path::Iterator::lineTo:       numFloats += 3; break;
+                case juce::Path::Iterator::quadraticTo:  numFloats += 5; break;
+                case juce::Path::Iterator::cubicTo:      numFloats += 7; break;
+                case juce::Path::Iterator::closePath:    numFloats += 1; break;
+                default: break;
+            }
+        }
+
+        return numFloats * sizeof(float);
+    }
+}
+
+FancyIconPack::IconGeometry FancyIconPack::recordIcon(IconId icon, juce::Rectangle<float> bounds,
+                                                      juce::Colour color, float physicalPixelScale)
+{
+    return recordDrawing(getDrawFunction(icon), bounds, color, physicalPixelScale);
+}
+
+FancyIconPack::IconGeometry FancyIconPack::recordDrawing(DrawFunction draw, juce::Rectangle<float> bounds,
+                                                         juce::Colour color, float physicalPixelScale)
+{
+    IconGeometry geometry;
+    geometry.bounds = bounds;
+
+    // Unselected icons have no draw function and record as empty
+    if (draw == nullptr)
+        return geometry;
+
+    RecordingContext context(geometry, physicalPixelScale);
+    juce::Graphics g(context);
+    draw(g, bounds, color);
+
+    return geometry;
+}
+
+void FancyIconPack::IconGeometry::draw(juce::Graphics& g, juce::Point<float> origin) const
+{
+    auto offset = juce::AffineTransform::translation(origin - bounds.getPosition());
+    auto delta = origin - bounds.getPosition();
+
+    const juce::FillType* currentFill = nullptr;
+
+    for (auto& op : ops)
+    {
+        // Consecutive ops usually share a fill, and each change costs a state update
+        if (currentFill == nullptr || *currentFill != op.fill)
+        {
+            g.setFillType(op.fill);
+            currentFill = &op.fill;
+        }
+
+        switch (op.type)
+        {
+            case Op::Type::path:
+                g.fillPath(op.path, offset);
+                break;
+
+            case Op::Type::rectangle:
+                g.fillRect(op.rectangle + delta);
+                break;
+
+            case Op::Type::glyph:
+            {
+                // Go through setFont() so a pending saveState() on g is honoured
+                g.setFont(op.font);
+               #if JUCE_MAJOR_VERSION >= 8
+                auto glyph = (juce::uint16) op.glyph;
+                juce::Point<float> position;
+                g.getInternalContext().drawGlyphs({ &glyph, 1 }, { &position, 1 }, op.glyphTransform.followedBy(offset));
+               #else
+                g.getInternalContext().drawGlyph(op.glyph, op.glyphTransform.followedBy(offset));
+               #endif
+                break;
+            }
+        }
+    }
+}
+
+size_t FancyIconPack::IconGeometry::getMemoryUsage() const noexcept
+{
+    auto total = sizeof(IconGeometry) + (size_t) ops.size() * sizeof(Op);
+
+    for (auto& op : ops)
+        if (op.type == Op::Type::path)
+            total += getPathMemoryUsage(op.path);
+
+    return total;
+}
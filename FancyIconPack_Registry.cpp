@@ -0,0 +1,104 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// ICON REGISTRY IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    using IconId = FancyIconPack::IconId;
+
+    struct IconEntry
+    {
+        IconId icon;
+        FancyIconPack::DrawFunction draw;
+    };
+
+    static_assert(FancyIconPack::numSelectedIcons > 0, "FANCYICONPACK_SELECTED_ICONS must list at least one icon");
+
+    // Only selected icons are referenced here, so this is the one place that
+    // keeps a draw* function alive in the link
+   #define FANCYICONPACK_ICON_ENTRY(name) { IconId::name, &FancyIconPack::draw##name },
+    const IconEntry iconEntries[] = { FANCYICONPACK_SELECTED_ICONS(FANCYICONPACK_ICON_ENTRY) };
+   #undef FANCYICONPACK_ICON_ENTRY
+
+    static_assert(sizeof(iconEntries) / sizeof(iconEntries[0]) == FancyIconPack::numSelectedIcons,
+                  "Icon table out of sync with FANCYICONPACK_SELECTED_ICONS");
+
+    // Names cost a few bytes each and keep reports and baked data readable, so
+    // they cover every icon whether selected or not
+   #define FANCYICONPACK_ICON_NAME(name) #name,
+    const char* const iconNames[] = { FANCYICONPACK_ICON_LIST(FANCYICONPACK_ICON_NAME) };
+   #undef FANCYICONPACK_ICON_NAME
+
+    static_assert(sizeof(iconNames) / sizeof(iconNames[0]) == FancyIconPack::numIcons,
+                  "Icon names out of sync with FANCYICONPACK_ICON_LIST");
+
+    struct SlotTable
+    {
+        juce::int16 slots[FancyIconPack::numIcons];
+        bool hasDuplicates;
+    };
+
+    /** Maps each IconId to its row in iconEntries, or -1 when it isn't selected */
+    constexpr SlotTable createSlotTable()
+    {
+       #define FANCYICONPACK_ICON_ID(name) IconId::name,
+        constexpr IconId selected[] = { FANCYICONPACK_SELECTED_ICONS(FANCYICONPACK_ICON_ID) };
+       #undef FANCYICONPACK_ICON_ID
+
+        SlotTable table {};
+
+        for (auto& slot : table.slots)
+            slot = -1;
+
+        for (int i = 0; i < FancyIconPack::numSelectedIcons; ++i)
+        {
+            auto& slot = table.slots[static_cast<int>(selected[i])];
+            table.hasDuplicates = table.hasDuplicates || slot >= 0;
+            slot = static_cast<juce::int16>(i);
+        }
+
+        return table;
+    }
+
+    constexpr SlotTable slotTable = createSlotTable();
+
+    static_assert(! slotTable.hasDuplicates, "FANCYICONPACK_SELECTED_ICONS lists an icon more than once");
+}
+
+FancyIconPack::DrawFunction FancyIconPack::getDrawFunction(IconId icon) noexcept
+{
+    auto index = static_cast<int>(icon);
+    jassert(juce::isPositiveAndBelow(index, numIcons));
+    auto slot = slotTable.slots[index];
+    return slot >= 0 ? iconEntries[slot].draw : nullptr;
+}
+
+bool FancyIconPack::isIconSelected(IconId icon) noexcept
+{
+    auto index = static_cast<int>(icon);
+    jassert(juce::isPositiveAndBelow(index, numIcons));
+    return slotTable.slots[index] >= 0;
+}
+
+const char* FancyIconPack::getIconName(IconId icon) noexcept
+{
+    auto index = static_cast<int>(icon);
+    jassert(juce::isPositiveAndBelow(index, numIcons));
+    return iconNames[index];
+}
+
+void FancyIconPack::drawIcon(juce::Graphics& g, IconId icon, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    auto draw = getDrawFunction(icon);
+
+    // The icon was left out of FANCYICONPACK_SELECTED_ICONS
+    jassert(draw != nullptr);
+
+    if (draw == nullptr)
+        return;
+
+    const Stats::ScopedDrawTimer timer(icon, Stats::DrawPath::live);
+    draw(g, bounds, color);
+}
@@ -0,0 +1,251 @@
+#include "FancyIconPack.h"
+
+#if FANCYICONPACK_ENABLE_SIMD
+ #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define FANCYICONPACK_SIMD_X86 1
+  #include <immintrin.h>
+ #elif defined (__ARM_NEON) || defined (__ARM_NEON__) || defined (_M_ARM64)
+  #define FANCYICONPACK_SIMD_NEON 1
+  #include <arm_neon.h>
+ #endif
+#endif
+
+// ============================================================================
+// LIVE SPECTRUM IMPLEMENTATION
+// ============================================================================
+// SSE2 and NEON are baseline on every target that has them, so unlike the
+// mask compositing kernels these need no runtime dispatch.
+
+namespace
+{
+    float findRangeMaximum(const float* data, int num) noexcept
+    {
+        auto result = 0.0f;
+        int i = 0;
+
+       #if FANCYICONPACK_SIMD_X86
+        if (num >= 8)
+        {
+            auto a = _mm_loadu_ps(data), b = _mm_loadu_ps(data + 4);
+
+            for (i = 8; i + 8 <= num; i += 8)
+            {
+                a = _mm_max_ps(a, _mm_loadu_ps(data + i));
+                b = _mm_max_ps(b, _mm_loadu_ps(data + i + 4));
+            }
+
+            alignas (16) float lanes[4];
+            _mm_store_ps(lanes, _mm_max_ps(a, b));
+            result = juce::jmax(lanes[0], lanes[1], lanes[2], lanes[3]);
+        }
+       #elif FANCYICONPACK_SIMD_NEON
+        if (num >= 8)
+        {
+            auto a = vld1q_f32(data), b = vld1q_f32(data + 4);
+
+            for (i = 8; i + 8 <= num; i += 8)
+            {
+                a = vmaxq_f32(a, vld1q_f32(data + i));
+                b = vmaxq_f32(b, vld1q_f32(data + i + 4));
+            }
+
+            auto m = vmaxq_f32(a, b);
+            auto pair = vpmax_f32(vget_low_f32(m), vget_high_f32(m));
+            result = vget_lane_f32(vpmax_f32(pair, pair), 0);
+        }
+       #endif
+
+        for (; i < num; ++i)
+            result = juce::jmax(result, data[i]);
+
+        return result;
+    }
+
+    float findRangeSum(const float* data, int num) noexcept
+    {
+        auto result = 0.0f;
+        int i = 0;
+
+       #if FANCYICONPACK_SIMD_X86
+        if (num >= 8)
+        {
+            auto a = _mm_setzero_ps(), b = _mm_setzero_ps();
+
+            for (; i + 8 <= num; i += 8)
+            {
+                a = _mm_add_ps(a, _mm_loadu_ps(data + i));
+                b = _mm_add_ps(b, _mm_loadu_ps(data + i + 4));
+            }
+
+            alignas (16) float lanes[4];
+            _mm_store_ps(lanes, _mm_add_ps(a, b));
+            result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+       #elif FANCYICONPACK_SIMD_NEON
+        if (num >= 8)
+        {
+            auto a = vdupq_n_f32(0.0f), b = vdupq_n_f32(0.0f);
+
+            for (; i + 8 <= num; i += 8)
+            {
+                a = vaddq_f32(a, vld1q_f32(data + i));
+                b = vaddq_f32(b, vld1q_f32(data + i + 4));
+            }
+
+            auto sum = vaddq_f32(a, b);
+            auto pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+            result = vget_lane_f32(vpadd_f32(pair, pair), 0);
+        }
+       #endif
+
+        for (; i < num; ++i)
+            result += data[i];
+
+        return result;
+    }
+}
+
+// ============================================================================
+// SpectrumBinning
+// ============================================================================
+
+FancyIconPack::SpectrumBinning::SpectrumBinning(int numFFTBins, double sampleRate, int numBars, float minFrequency,
+                                                float maxFrequency, Mode binningMode)
+    : numBins(numFFTBins), mode(binningMode)
+{
+    jassert(numFFTBins > 1 && sampleRate > 0.0 && numBars > 0);
+    jassert(minFrequency > 0.0f && maxFrequency > minFrequency);
+
+    // Bin k of a real FFT sits at k * sampleRate / fftSize, with fftSize = 2 * (numFFTBins - 1)
+    auto binHz = sampleRate / (2.0 * juce::jmax(1, numFFTBins - 1));
+    auto lowHz = (double) juce::jmax(minFrequency, 1.0e-3f);
+    auto highHz = juce::jlimit(lowHz * 1.001, sampleRate * 0.5, (double) maxFrequency);
+    auto ratio = highHz / lowHz;
+
+    ranges.ensureStorageAllocated(numBars);
+
+    for (int i = 0; i < numBars; ++i)
+    {
+        auto lo = lowHz * std::pow(ratio, i / (double) numBars);
+        auto hi = lowHz * std::pow(ratio, (i + 1) / (double) numBars);
+
+        // Adjacent bars share their edges, so every bin lands in exactly one bar
+        // except at the bottom, where bars narrower than a bin repeat it
+        auto start = juce::jlimit(0, numBins - 1, (int) std::ceil(lo / binHz));
+        auto end = juce::jlimit(start + 1, numBins, (int) std::ceil(hi / binHz));
+
+        ranges.add({ start, end });
+    }
+}
+
+void FancyIconPack::SpectrumBinning::process(const float* magnitudes, float* bars) const noexcept
+{
+    for (auto& range : ranges)
+    {
+        auto* data = magnitudes + range.start;
+        auto num = range.end - range.start;
+
+        *bars++ = mode == Mode::peak ? findRangeMaximum(data, num)
+                                     : findRangeSum(data, num) / (float) num;
+    }
+}
+
+// ============================================================================
+// LiveSpectrum
+// ============================================================================
+
+FancyIconPack::LiveSpectrum::LiveSpectrum(int numBars)
+    : LiveSpectrum(numBars, Ballistics())
+{
+}
+
+FancyIconPack::LiveSpectrum::LiveSpectrum(int numBars, const Ballistics& newBallistics)
+    : ballistics(newBallistics)
+{
+    jassert(numBars > 0);
+    bars.insertMultiple(0, { minimumDb, minimumDb, 0.0f }, juce::jmax(1, numBars));
+}
+
+float FancyIconPack::LiveSpectrum::toProportion(float db) const noexcept
+{
+    return juce::jlimit(0.0f, 1.0f, (db - ballistics.floorDb) / (ballistics.ceilingDb - ballistics.floorDb));
+}
+
+bool FancyIconPack::LiveSpectrum::update(const float* barMagnitudes, float elapsedSeconds)
+{
+    auto decay = ballistics.decayDbPerSecond * elapsedSeconds;
+    auto changed = false;
+
+    for (int i = 0; i < bars.size(); ++i)
+    {
+        auto& bar = bars.getReference(i);
+        auto oldLevel = toProportion(bar.levelDb);
+        auto oldHeld = toProportion(bar.heldDb);
+
+        auto levelIn = barMagnitudes != nullptr ? juce::Decibels::gainToDecibels(barMagnitudes[i], minimumDb)
+                                                : minimumDb;
+
+        // Rises are shown immediately, falls are limited to the decay rate
+        bar.levelDb = juce::jmax(levelIn, bar.levelDb - decay, minimumDb);
+
+        if (bar.levelDb >= bar.heldDb)
+        {
+            bar.heldDb = bar.levelDb;
+            bar.holdRemaining = ballistics.peakHoldSeconds;
+        }
+        else
+        {
+            bar.holdRemaining -= elapsedSeconds;
+
+            if (bar.holdRemaining <= 0.0f)
+            {
+                bar.holdRemaining = 0.0f;
+                bar.heldDb = juce::jmax(bar.levelDb, bar.heldDb - decay);
+            }
+        }
+
+        // Below the floor nothing is drawn, so no repaint is needed
+        changed = changed || toProportion(bar.levelDb) != oldLevel || toProportion(bar.heldDb) != oldHeld;
+    }
+
+    return changed;
+}
+
+void FancyIconPack::LiveSpectrum::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    auto stroke = getOptimalStrokeWidth(bounds);
+
+    // Same layout as drawSpectrumDisplay, using plain rectangles so nothing builds a path
+    auto barCount = bars.size();
+    auto barWidth = bounds.getWidth() / (barCount * 1.5f);
+    auto spacing = barWidth * 0.5f;
+    auto maxBarHeight = bounds.getHeight() * 0.8f;
+    auto peakHeight = stroke * 0.8f;
+    auto peakColor = color.brighter(0.3f);
+
+    for (int i = 0; i < barCount; ++i)
+    {
+        auto& bar = bars.getReference(i);
+        auto barX = bounds.getX() + i * (barWidth + spacing);
+        auto barHeight = maxBarHeight * toProportion(bar.levelDb);
+        auto heldHeight = maxBarHeight * toProportion(bar.heldDb);
+
+        if (barHeight > 0.0f)
+        {
+            g.setColour(color);
+            g.fillRect(barX, bounds.getBottom() - barHeight, barWidth, barHeight);
+        }
+
+        if (heldHeight > 0.0f)
+        {
+            g.setColour(peakColor);
+            g.fillRect(barX, bounds.getBottom() - heldHeight - peakHeight - stroke, barWidth, peakHeight);
+        }
+    }
+}
+
+void FancyIconPack::LiveSpectrum::reset()
+{
+    for (auto& bar : bars)
+        bar = { minimumDb, minimumDb, 0.0f };
+}
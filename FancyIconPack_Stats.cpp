@@ -0,0 +1,269 @@
+#include "FancyIconPack.h"
+#include <atomic>
+
+// ============================================================================
+// STATISTICS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    juce::var createCacheObject(const FancyIconPack::Stats::CacheCounters& counters)
+    {
+        auto* cache = new juce::DynamicObject();
+        cache->setProperty("hits", (juce::int64) counters.hits);
+        cache->setProperty("misses", (juce::int64) counters.misses);
+        cache->setProperty("evictions", (juce::int64) counters.evictions);
+        cache->setProperty("bytesResident", (juce::int64) counters.bytesResident);
+        return juce::var(cache);
+    }
+
+   #if FANCYICONPACK_ENABLE_STATS
+    const char* getPathName(FancyIconPack::Stats::DrawPath path) noexcept
+    {
+        switch (path)
+        {
+            case FancyIconPack::Stats::DrawPath::live:   return "live";
+            case FancyIconPack::Stats::DrawPath::cached: return "cached";
+            case FancyIconPack::Stats::DrawPath::baked:  return "baked";
+        }
+
+        return "";
+    }
+
+    double ticksToMs(juce::int64 ticks) noexcept
+    {
+        return juce::Time::highResolutionTicksToSeconds(ticks) * 1000.0;
+    }
+
+    struct IconCounters
+    {
+        std::atomic<juce::uint64> calls { 0 };
+        std::atomic<juce::int64> totalTicks { 0 };
+        std::atomic<juce::int64> maxTicks { 0 };
+    };
+
+    struct TraceEvent
+    {
+        FancyIconPack::IconId icon;
+        FancyIconPack::Stats::DrawPath path;
+        juce::pointer_sized_int threadId;
+        juce::int64 startTicks, durationTicks;
+    };
+
+    // Only the most recent draws are kept for tracing, so memory stays fixed
+    // however long the session runs
+    constexpr int traceCapacity = 16384;
+
+    struct Counters
+    {
+        IconCounters icons[FancyIconPack::numIcons];
+
+        std::atomic<juce::uint64> cacheHits { 0 }, cacheMisses { 0 }, cacheEvictions { 0 };
+        std::atomic<juce::int64> cacheBytes { 0 };
+
+        juce::SpinLock traceLock;
+        TraceEvent trace[traceCapacity];
+        int traceNext = 0, traceSize = 0;
+    };
+
+    Counters& getCounters()
+    {
+        static Counters counters;
+        return counters;
+    }
+
+    thread_local int drawDepth = 0;
+   #endif
+}
+
+// ----------------------------------------------------------------------------
+
+#if FANCYICONPACK_ENABLE_STATS
+
+FancyIconPack::Stats::ScopedDrawTimer::ScopedDrawTimer(IconId iconToTime, DrawPath drawPath) noexcept
+    : icon(iconToTime), path(drawPath), isOutermost(drawDepth++ == 0)
+{
+    if (isOutermost)
+        startTicks = juce::Time::getHighResolutionTicks();
+}
+
+FancyIconPack::Stats::ScopedDrawTimer::~ScopedDrawTimer()
+{
+    --drawDepth;
+
+    if (! isOutermost)
+        return;
+
+    auto duration = juce::Time::getHighResolutionTicks() - startTicks;
+    auto& counters = getCounters();
+    auto& entry = counters.icons[(int) icon];
+
+    entry.calls.fetch_add(1, std::memory_order_relaxed);
+    entry.totalTicks.fetch_add(duration, std::memory_order_relaxed);
+
+    auto previousMax = entry.maxTicks.load(std::memory_order_relaxed);
+
+    while (duration > previousMax
+           && ! entry.maxTicks.compare_exchange_weak(previousMax, duration, std::memory_order_relaxed))
+    {
+    }
+
+    const juce::SpinLock::ScopedLockType sl(counters.traceLock);
+    counters.trace[counters.traceNext] = { icon, path, (juce::pointer_sized_int) juce::Thread::getCurrentThreadId(),
+                                           startTicks, duration };
+    counters.traceNext = (counters.traceNext + 1) % traceCapacity;
+    counters.traceSize = juce::jmin(counters.traceSize + 1, traceCapacity);
+}
+
+void FancyIconPack::Stats::cacheHit() noexcept
+{
+    getCounters().cacheHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FancyIconPack::Stats::cacheMiss(size_t bytesAdded) noexcept
+{
+    auto& counters = getCounters();
+    counters.cacheMisses.fetch_add(1, std::memory_order_relaxed);
+    counters.cacheBytes.fetch_add((juce::int64) bytesAdded, std::memory_order_relaxed);
+}
+
+void FancyIconPack::Stats::cacheEvicted(size_t bytesRemoved) noexcept
+{
+    auto& counters = getCounters();
+    counters.cacheEvictions.fetch_add(1, std::memory_order_relaxed);
+    counters.cacheBytes.fetch_sub((juce::int64) bytesRemoved, std::memory_order_relaxed);
+}
+
+void FancyIconPack::Stats::cacheReleased(size_t bytesRemoved) noexcept
+{
+    getCounters().cacheBytes.fetch_sub((juce::int64) bytesRemoved, std::memory_order_relaxed);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+
+FancyIconPack::Stats::Snapshot FancyIconPack::Stats::getSnapshot()
+{
+    Snapshot snapshot;
+
+   #if FANCYICONPACK_ENABLE_STATS
+    auto& counters = getCounters();
+
+    for (auto& icon : counters.icons)
+    {
+        IconTiming timing;
+        timing.calls = icon.calls.load(std::memory_order_relaxed);
+        timing.totalMs = ticksToMs(icon.totalTicks.load(std::memory_order_relaxed));
+        timing.maxMs = ticksToMs(icon.maxTicks.load(std::memory_order_relaxed));
+        snapshot.icons.add(timing);
+    }
+
+    snapshot.geometryCache.hits = counters.cacheHits.load(std::memory_order_relaxed);
+    snapshot.geometryCache.misses = counters.cacheMisses.load(std::memory_order_relaxed);
+    snapshot.geometryCache.evictions = counters.cacheEvictions.load(std::memory_order_relaxed);
+    snapshot.geometryCache.bytesResident = (size_t) juce::jmax((juce::int64) 0,
+                                                               counters.cacheBytes.load(std::memory_order_relaxed));
+   #endif
+
+    return snapshot;
+}
+
+void FancyIconPack::Stats::reset()
+{
+   #if FANCYICONPACK_ENABLE_STATS
+    auto& counters = getCounters();
+
+    for (auto& icon : counters.icons)
+    {
+        icon.calls = 0;
+        icon.totalTicks = 0;
+        icon.maxTicks = 0;
+    }
+
+    counters.cacheHits = 0;
+    counters.cacheMisses = 0;
+    counters.cacheEvictions = 0;
+
+    const juce::SpinLock::ScopedLockType sl(counters.traceLock);
+    counters.traceNext = 0;
+    counters.traceSize = 0;
+   #endif
+}
+
+juce::String FancyIconPack::Stats::Snapshot::toJSON() const
+{
+    juce::Array<juce::var> iconList;
+
+    for (int i = 0; i < icons.size(); ++i)
+    {
+        auto& timing = icons.getReference(i);
+
+        if (timing.calls == 0)
+            continue;
+
+        auto* icon = new juce::DynamicObject();
+        icon->setProperty("name", getIconName(static_cast<IconId>(i)));
+        icon->setProperty("calls", (juce::int64) timing.calls);
+        icon->setProperty("totalMs", timing.totalMs);
+        icon->setProperty("meanMs", timing.totalMs / (double) timing.calls);
+        icon->setProperty("maxMs", timing.maxMs);
+        iconList.add(juce::var(icon));
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("enabled", isEnabled);
+    root->setProperty("icons", iconList);
+    root->setProperty("geometryCache", createCacheObject(geometryCache));
+
+    return juce::JSON::toString(juce::var(root));
+}
+
+juce::String FancyIconPack::Stats::createChromeTrace()
+{
+    juce::Array<juce::var> events;
+
+   #if FANCYICONPACK_ENABLE_STATS
+    juce::Array<TraceEvent> recent;
+
+    {
+        auto& counters = getCounters();
+        const juce::SpinLock::ScopedLockType sl(counters.traceLock);
+        auto first = (counters.traceNext - counters.traceSize + traceCapacity) % traceCapacity;
+
+        for (int i = 0; i < counters.traceSize; ++i)
+            recent.add(counters.trace[(first + i) % traceCapacity]);
+    }
+
+    // Trace viewers want microseconds from an arbitrary origin, so start at the
+    // oldest event
+    auto origin = recent.isEmpty() ? (juce::int64) 0 : recent.getFirst().startTicks;
+
+    for (auto& e : recent)
+    {
+        auto* event = new juce::DynamicObject();
+        event->setProperty("name", getIconName(e.icon));
+        event->setProperty("cat", getPathName(e.path));
+        event->setProperty("ph", "X");
+        event->setProperty("ts", ticksToMs(e.startTicks - origin) * 1000.0);
+        event->setProperty("dur", ticksToMs(e.durationTicks) * 1000.0);
+        event->setProperty("pid", 1);
+        event->setProperty("tid", (juce::int64) e.threadId);
+        events.add(juce::var(event));
+    }
+
+    auto* counter = new juce::DynamicObject();
+    counter->setProperty("name", "GeometryCache");
+    counter->setProperty("ph", "C");
+    counter->setProperty("ts", recent.isEmpty() ? 0.0 : ticksToMs(recent.getLast().startTicks - origin) * 1000.0);
+    counter->setProperty("pid", 1);
+    counter->setProperty("args", createCacheObject(getSnapshot().geometryCache));
+    events.add(juce::var(counter));
+   #endif
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("traceEvents", events);
+    root->setProperty("displayTimeUnit", "ms");
+
+    return juce::JSON::toString(juce::var(root));
+}
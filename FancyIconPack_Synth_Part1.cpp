@@ -23,8 +23,8 @@ void FancyIconPack::drawOsc(juce::Graphics& g, juce::Rectangle<float> bounds, ju
     for (int i = 1; i <= points; ++i)
     {
         auto x = iconBounds.getX() + (i / static_cast<float>(points)) * iconBounds.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         sineWave.lineTo(x, waveY + amp);
     }
 
@@ -50,6 +50,17 @@ void FancyIconPack::drawOsc(juce::Graphics& g, juce::Rectangle<float> bounds, ju
 }
 
 void FancyIconPack::drawOsc1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawOscillatorBase(g, bounds, color);
+
+    // "1" label
+    auto labelArea = bounds.withTrimmedTop(bounds.getHeight() * 0.6f);
+    g.setColour(color);
+    g.setFont(juce::Font(labelArea.getHeight() * 0.8f, juce::Font::bold));
+    g.drawText("1", labelArea, juce::Justification::centred);
+}
+
+void FancyIconPack::drawOscillatorBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -68,18 +79,13 @@ void FancyIconPack::drawOsc1(juce::Graphics& g, juce::Rectangle<float> bounds, j
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 1.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         sineWave.lineTo(x, waveY + amp);
     }
 
     g.setColour(color);
     g.strokePath(sineWave, createStroke(stroke));
-
-    // "1" label
-    auto labelArea = iconBounds.removeFromBottom(iconBounds.getHeight());
-    g.setFont(juce::Font(labelArea.getHeight() * 0.8f, juce::Font::bold));
-    g.drawText("1", labelArea, juce::Justification::centred);
 }
 
 void FancyIconPack::drawOsc2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
@@ -173,8 +179,8 @@ void FancyIconPack::drawSubOsc(juce::Graphics& g, juce::Rectangle<float> bounds,
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 0.5f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = (i / static_cast<float>(points)) * 0.5f;
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         subWave.lineTo(x, waveY + amp);
     }
 
@@ -345,6 +351,17 @@ void FancyIconPack::drawPolyphony(juce::Graphics& g, juce::Rectangle<float> boun
 // ============================================================================
 
 void FancyIconPack::drawFilter1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawFilterBase(g, bounds, color);
+
+    // "F1" label
+    auto labelArea = bounds.withTrimmedTop(bounds.getHeight() * 0.6f);
+    g.setColour(color);
+    g.setFont(juce::Font(labelArea.getHeight() * 0.8f, juce::Font::bold));
+    g.drawText("F1", labelArea, juce::Justification::centred);
+}
+
+void FancyIconPack::drawFilterBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -375,11 +392,6 @@ void FancyIconPack::drawFilter1(juce::Graphics& g, juce::Rectangle<float> bounds
 
     g.setColour(color);
     g.strokePath(filterCurve, createStroke(stroke));
-
-    // "F1" label
-    auto labelArea = iconBounds.removeFromBottom(iconBounds.getHeight());
-    g.setFont(juce::Font(labelArea.getHeight() * 0.8f, juce::Font::bold));
-    g.drawText("F1", labelArea, juce::Justification::centred);
 }
 
 void FancyIconPack::drawFilter2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
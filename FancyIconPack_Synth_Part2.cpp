@@ -8,6 +8,17 @@
 // ============================================================================
 
 void FancyIconPack::drawEnv1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawEnvelopeBase(g, bounds, color);
+
+    // "ENV1" label
+    auto labelArea = bounds.withTrimmedTop(bounds.getHeight() * 0.6f);
+    g.setColour(color);
+    g.setFont(juce::Font(labelArea.getHeight() * 0.6f, juce::Font::bold));
+    g.drawText("ENV1", labelArea, juce::Justification::centred);
+}
+
+void FancyIconPack::drawEnvelopeBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -35,11 +46,6 @@ void FancyIconPack::drawEnv1(juce::Graphics& g, juce::Rectangle<float> bounds, j
 
     g.setColour(color);
     g.strokePath(envelope, createStroke(stroke));
-
-    // "ENV1" label
-    auto labelArea = iconBounds.removeFromBottom(iconBounds.getHeight());
-    g.setFont(juce::Font(labelArea.getHeight() * 0.6f, juce::Font::bold));
-    g.drawText("ENV1", labelArea, juce::Justification::centred);
 }
 
 void FancyIconPack::drawEnv2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
@@ -100,6 +106,17 @@ void FancyIconPack::drawEnv2(juce::Graphics& g, juce::Rectangle<float> bounds, j
 }
 
 void FancyIconPack::drawLFO1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawLFOBase(g, bounds, color);
+
+    // "LFO1" label
+    auto labelArea = bounds.withTrimmedTop(bounds.getHeight() * 0.6f);
+    g.setColour(color);
+    g.setFont(juce::Font(labelArea.getHeight() * 0.6f, juce::Font::bold));
+    g.drawText("LFO1", labelArea, juce::Justification::centred);
+}
+
+void FancyIconPack::drawLFOBase(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -118,8 +135,8 @@ void FancyIconPack::drawLFO1(juce::Graphics& g, juce::Rectangle<float> bounds, j
     for (int i = 1; i <= points; ++i)
     {
         auto x = waveArea.getX() + (i / static_cast<float>(points)) * waveArea.getWidth();
-        auto phase = (i / static_cast<float>(points)) * juce::MathConstants<float>::twoPi * 1.0f;
-        auto amp = std::sin(phase) * amplitude;
+        auto cycles = i / static_cast<float>(points);
+        auto amp = WaveTables::getInstance().getValue(WaveShape::sine, cycles) * amplitude;
         lfoWave.lineTo(x, waveY + amp);
     }
 
@@ -144,12 +161,6 @@ void FancyIconPack::drawLFO1(juce::Graphics& g, juce::Rectangle<float> bounds, j
 
         g.fillPath(arrow);
     }
-
-    // "LFO1" label
-    auto labelArea = iconBounds.removeFromBottom(iconBounds.getHeight());
-    g.setColour(color);
-    g.setFont(juce::Font(labelArea.getHeight() * 0.6f, juce::Font::bold));
-    g.drawText("LFO1", labelArea, juce::Justification::centred);
 }
 
 void FancyIconPack::drawLFO2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
@@ -953,6 +964,17 @@ void FancyIconPack::drawAnalyzer(juce::Graphics& g, juce::Rectangle<float> bound
 }
 
 void FancyIconPack::drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
+{
+    drawTuner(g, bounds, color, 0.65f); // Slightly sharp
+}
+
+void FancyIconPack::drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    drawTunerFrame(g, bounds, color);
+    drawTunerNeedle(g, bounds, color, value);
+}
+
+void FancyIconPack::drawTunerFrame(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color)
 {
     auto iconBounds = bounds;
     auto stroke = getOptimalStrokeWidth(iconBounds);
@@ -1006,11 +1028,6 @@ void FancyIconPack::drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds,
     g.setColour(color.withAlpha(0.5f));
     g.drawLine(centerX, meterY, centerX, meterY + meterHeight, stroke * 0.6f);
 
-    // Tuning indicator needle (slightly sharp)
-    auto needleX = centerX + meterWidth * 0.15f; // Slightly to the right (sharp)
-    g.setColour(color.brighter(0.2f));
-    g.drawLine(needleX, meterY + meterHeight * 0.2f, needleX, meterY + meterHeight * 0.8f, stroke * 1.2f);
-
     // Meter scale marks
     g.setColour(color.withAlpha(0.6f));
     for (int i = -2; i <= 2; ++i)
@@ -1037,3 +1054,21 @@ void FancyIconPack::drawTuner(juce::Graphics& g, juce::Rectangle<float> bounds,
                                          iconBounds.getWidth() * 0.2f, iconBounds.getHeight() * 0.12f);
     g.drawText("A", noteArea, juce::Justification::centred);
 }
+
+void FancyIconPack::drawTunerNeedle(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+
+    // Same pitch meter layout as drawTunerFrame
+    auto centerX = iconBounds.getCentreX();
+    auto forkBottom = iconBounds.getCentreY() + iconBounds.getHeight() * 0.6f * 0.3f;
+    auto meterY = forkBottom + iconBounds.getHeight() * 0.1f;
+    auto meterWidth = iconBounds.getWidth() * 0.7f;
+    auto meterHeight = iconBounds.getHeight() * 0.15f;
+
+    // Tuning indicator needle: flat on the left, in tune at 0.5, sharp on the right
+    auto needleX = centerX + meterWidth * (juce::jlimit(0.0f, 1.0f, value) - 0.5f);
+    g.setColour(color.brighter(0.2f));
+    g.drawLine(needleX, meterY + meterHeight * 0.2f, needleX, meterY + meterHeight * 0.8f, stroke * 1.2f);
+}
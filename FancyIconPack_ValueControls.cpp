@@ -0,0 +1,126 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// VALUE CONTROLS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    constexpr size_t maxCachedFrames = 64;
+
+    // Room around the icon bounds for strokes that straddle the edge, in logical pixels
+    constexpr float frameMargin = 2.0f;
+
+    /** The margin rounded up to whole physical pixels, so the frame keeps the live drawing's pixel grid */
+    float getMarginPixels(float physicalPixelScale) noexcept
+    {
+        return std::ceil(frameMargin * physicalPixelScale);
+    }
+
+    struct FrameKey
+    {
+        FancyIconPack::DrawFunction draw;
+        int width, height, scale;
+        juce::uint32 argb;
+
+        bool operator==(const FrameKey& other) const noexcept
+        {
+            return draw == other.draw && width == other.width && height == other.height
+                && scale == other.scale && argb == other.argb;
+        }
+    };
+
+    struct FrameCache
+    {
+        juce::CriticalSection lock;
+
+        // Most recently used first; small enough that a linear search is fine
+        std::list<std::pair<FrameKey, std::shared_ptr<const juce::Image>>> entries;
+    };
+
+    std::shared_ptr<const juce::Image> renderFrame(FancyIconPack::DrawFunction draw, juce::Point<float> size,
+                                                   juce::Colour color, float physicalPixelScale)
+    {
+        auto marginPixels = getMarginPixels(physicalPixelScale);
+        auto width = juce::jmax(1, (int) std::ceil(size.x * physicalPixelScale + marginPixels * 2.0f));
+        auto height = juce::jmax(1, (int) std::ceil(size.y * physicalPixelScale + marginPixels * 2.0f));
+
+        auto image = std::make_shared<juce::Image>(juce::Image::ARGB, width, height, true);
+
+        juce::Graphics g(*image);
+        g.addTransform(juce::AffineTransform::scale(physicalPixelScale).translated(marginPixels, marginPixels));
+        draw(g, { 0.0f, 0.0f, size.x, size.y }, color);
+
+        return image;
+    }
+
+    std::shared_ptr<const juce::Image> getCachedFrame(FancyIconPack::DrawFunction draw, juce::Point<float> size,
+                                                      juce::Colour color, float physicalPixelScale)
+    {
+        static FrameCache cache;
+
+        FrameKey key { draw,
+                       juce::roundToInt(size.x * 64.0f),
+                       juce::roundToInt(size.y * 64.0f),
+                       juce::roundToInt(physicalPixelScale * 64.0f),
+                       color.getARGB() };
+
+        const juce::ScopedLock sl(cache.lock);
+
+        for (auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+        {
+            if (it->first == key)
+            {
+                cache.entries.splice(cache.entries.begin(), cache.entries, it);
+                return it->second;
+            }
+        }
+
+        auto image = renderFrame(draw, size, color, physicalPixelScale);
+        cache.entries.emplace_front(key, image);
+
+        if (cache.entries.size() > maxCachedFrames)
+            cache.entries.pop_back();
+
+        return image;
+    }
+}
+
+// ============================================================================
+// ValueIcon
+// ============================================================================
+
+FancyIconPack::ValueIcon::ValueIcon(DrawFunction frameToDraw, ValueDrawFunction valueLayerToDraw)
+    : frame(frameToDraw), valueLayer(valueLayerToDraw)
+{
+    jassert(frame != nullptr && valueLayer != nullptr);
+}
+
+void FancyIconPack::ValueIcon::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color, float value)
+{
+    auto currentScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    juce::Point<float> currentSize(bounds.getWidth(), bounds.getHeight());
+
+    if (frameImage == nullptr || currentSize != size || currentScale != scale || color != frameColor)
+    {
+        size = currentSize;
+        scale = currentScale;
+        frameColor = color;
+        frameImage = getCachedFrame(frame, size, color, scale);
+    }
+
+    // Whole physical pixels, so the frame isn't resampled at fractional origins;
+    // the value layer moves with it to stay aligned
+    auto snapped = bounds.withPosition((bounds.getPosition() * scale).roundToInt().toFloat() / scale);
+    auto margin = getMarginPixels(scale) / scale;
+    g.drawImageTransformed(*frameImage,
+                           juce::AffineTransform::scale(1.0f / scale)
+                               .translated(snapped.getX() - margin, snapped.getY() - margin));
+
+    valueLayer(g, snapped, color, juce::jlimit(0.0f, 1.0f, value));
+}
+
+size_t FancyIconPack::ValueIcon::getMemoryUsage() const noexcept
+{
+    return frameImage != nullptr ? (size_t) frameImage->getWidth() * (size_t) frameImage->getHeight() * 4 : 0;
+}
@@ -0,0 +1,180 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// VOICE ACTIVITY IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    int findLowestBit(juce::uint64 bits) noexcept
+    {
+        int index = 0;
+
+        while ((bits & 1) == 0)
+        {
+            bits >>= 1;
+            ++index;
+        }
+
+        return index;
+    }
+}
+
+// ============================================================================
+// VoiceActivity
+// ============================================================================
+
+void FancyIconPack::VoiceActivity::setVoice(int voice, Stage stage, float level) noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, maxVoices));
+
+    auto bit = (juce::uint64) 1 << (voice & 63);
+    auto& word = activeBits[voice >> 6];
+
+    if (stage == Stage::idle)
+    {
+        word.fetch_and(~bit, std::memory_order_relaxed);
+        states[voice].store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    auto packedLevel = juce::jlimit(0, 31, juce::roundToInt(level * 31.0f));
+    states[voice].store((juce::uint8) (((int) stage << 5) | packedLevel), std::memory_order_relaxed);
+    word.fetch_or(bit, std::memory_order_release);
+}
+
+void FancyIconPack::VoiceActivity::clear() noexcept
+{
+    for (auto& word : activeBits)
+        word.store(0, std::memory_order_relaxed);
+
+    for (auto& state : states)
+        state.store(0, std::memory_order_relaxed);
+}
+
+bool FancyIconPack::VoiceActivity::isActive(int voice) const noexcept
+{
+    jassert(juce::isPositiveAndBelow(voice, maxVoices));
+    return (activeBits[voice >> 6].load(std::memory_order_acquire) >> (voice & 63)) & 1;
+}
+
+juce::uint8 FancyIconPack::VoiceActivity::getPackedState(int voice) const noexcept
+{
+    return isActive(voice) ? states[voice].load(std::memory_order_relaxed) : (juce::uint8) 0;
+}
+
+// ============================================================================
+// VoiceActivityView
+// ============================================================================
+
+FancyIconPack::VoiceActivityView::VoiceActivityView(int voices)
+    : numVoices(juce::jlimit(1, VoiceActivity::maxVoices, voices))
+{
+    jassert(voices > 0 && voices <= VoiceActivity::maxVoices);
+}
+
+bool FancyIconPack::VoiceActivityView::update(const VoiceActivity& activity)
+{
+    auto changed = false;
+
+    for (int w = 0; w < VoiceActivity::numWords; ++w)
+    {
+        auto bits = activity.activeBits[w].load(std::memory_order_acquire);
+        auto numInWord = numVoices - w * 64;
+
+        // Only voices the view shows; shifting by 64 or more is undefined, so whole words are handled apart
+        if (numInWord <= 0)
+            bits = 0;
+        else if (numInWord < 64)
+            bits &= ((juce::uint64) 1 << numInWord) - 1;
+
+        // Voices that just went idle still need their cell cleared
+        for (auto candidates = bits | previousBits[w]; candidates != 0; candidates &= candidates - 1)
+        {
+            auto voice = w * 64 + findLowestBit(candidates);
+            auto state = ((bits >> (voice & 63)) & 1) != 0
+                            ? activity.states[voice].load(std::memory_order_relaxed)
+                            : (juce::uint8) 0;
+
+            if (state != shownStates[voice])
+            {
+                shownStates[voice] = state;
+                dirty.setBit(voice);
+                changed = true;
+            }
+        }
+
+        previousBits[w] = bits;
+    }
+
+    return changed;
+}
+
+int FancyIconPack::VoiceActivityView::getNumColumns(juce::Rectangle<float> bounds) const noexcept
+{
+    // Roughly square cells for the bounds' aspect ratio
+    auto aspect = bounds.getHeight() > 0.0f ? bounds.getWidth() / bounds.getHeight() : 1.0f;
+    return juce::jlimit(1, numVoices, (int) std::ceil(std::sqrt(numVoices * aspect)));
+}
+
+juce::Rectangle<float> FancyIconPack::VoiceActivityView::getCellBounds(juce::Rectangle<float> bounds, int voice) const
+{
+    auto columns = getNumColumns(bounds);
+    auto rows = (numVoices + columns - 1) / columns;
+    auto cellWidth = bounds.getWidth() / (float) columns;
+    auto cellHeight = bounds.getHeight() / (float) rows;
+    auto gap = juce::jmin(cellWidth, cellHeight) * 0.1f;
+
+    return juce::Rectangle<float>(bounds.getX() + (voice % columns) * cellWidth,
+                                  bounds.getY() + (voice / columns) * cellHeight,
+                                  cellWidth, cellHeight).reduced(gap);
+}
+
+juce::RectangleList<int> FancyIconPack::VoiceActivityView::popDirtyRegion(juce::Rectangle<float> bounds)
+{
+    juce::RectangleList<int> region;
+
+    for (auto voice = dirty.findNextSetBit(0); voice >= 0; voice = dirty.findNextSetBit(voice + 1))
+        region.add(getCellBounds(bounds, voice).getSmallestIntegerContainer());
+
+    dirty.clear();
+    return region;
+}
+
+void FancyIconPack::VoiceActivityView::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    auto clip = g.getClipBounds().toFloat();
+
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        auto cell = getCellBounds(bounds, voice);
+
+        if (! cell.intersects(clip))
+            continue;
+
+        // Idle slot, as drawVoices' faded voice rows
+        g.setColour(color.withAlpha(0.15f));
+        g.fillRect(cell);
+
+        auto state = shownStates[voice];
+
+        if (state == 0)
+            continue;
+
+        auto stageColor = color;
+
+        switch (VoiceActivity::getStage(state))
+        {
+            case VoiceActivity::Stage::attack:  stageColor = color.brighter(0.4f); break;
+            case VoiceActivity::Stage::release: stageColor = color.withMultipliedAlpha(0.6f); break;
+            case VoiceActivity::Stage::decay:
+            case VoiceActivity::Stage::sustain:
+            case VoiceActivity::Stage::idle:    break;
+        }
+
+        // Level rises from the bottom of the cell
+        auto level = juce::jmax(0.1f, VoiceActivity::getLevel(state));
+        g.setColour(stageColor);
+        g.fillRect(cell.withTop(cell.getBottom() - cell.getHeight() * level));
+    }
+}
@@ -0,0 +1,194 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// WAVEFORM PYRAMID IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    // Columns resolved per getColumns() call while drawing, so draw() needs no heap buffer
+    constexpr int drawChunkSize = 256;
+}
+
+FancyIconPack::WaveformPyramid::WaveformPyramid(int blockSize)
+    : baseBlockSize(juce::jmax(1, blockSize))
+{
+    jassert(blockSize > 0);
+}
+
+void FancyIconPack::WaveformPyramid::addSamples(const float* samples, int num)
+{
+    const juce::ScopedLock sl(lock);
+
+    while (num > 0)
+    {
+        auto chunk = juce::jmin(num, baseBlockSize - numPending);
+        auto range = juce::FloatVectorOperations::findMinAndMax(samples, chunk);
+
+        pending = numPending == 0 ? range : pending.getUnionWith(range);
+        numPending += chunk;
+        numSamples += chunk;
+        samples += chunk;
+        num -= chunk;
+
+        if (numPending == baseBlockSize)
+        {
+            addBlock(0, pending);
+            numPending = 0;
+        }
+    }
+}
+
+void FancyIconPack::WaveformPyramid::addBlock(int level, juce::Range<float> block)
+{
+    if (level == levels.size())
+        levels.add({});
+
+    auto& entries = levels.getReference(level);
+    entries.add(block);
+
+    // Every second entry completes one in the level above
+    if (entries.size() % 2 == 0)
+        addBlock(level + 1, entries.getReference(entries.size() - 2).getUnionWith(block));
+}
+
+void FancyIconPack::WaveformPyramid::clear()
+{
+    const juce::ScopedLock sl(lock);
+    levels.clear();
+    numPending = 0;
+    numSamples = 0;
+}
+
+juce::int64 FancyIconPack::WaveformPyramid::getNumSamples() const
+{
+    const juce::ScopedLock sl(lock);
+    return numSamples;
+}
+
+void FancyIconPack::WaveformPyramid::addRange(int level, juce::int64 start, juce::int64 end,
+                                              juce::Range<float>& result, bool& found) const
+{
+    auto include = [&](juce::Range<float> r)
+    {
+        result = found ? result.getUnionWith(r) : r;
+        found = true;
+    };
+
+    auto covered = (juce::int64) 0;
+
+    if (level >= 0)
+    {
+        auto blockSize = (juce::int64) baseBlockSize << level;
+        auto& entries = levels.getReference(level);
+        covered = entries.size() * blockSize;
+
+        auto first = (int) (start / blockSize);
+        auto last = (int) juce::jmin((juce::int64) entries.size(), (end + blockSize - 1) / blockSize);
+
+        for (int i = first; i < last; ++i)
+            include(entries.getReference(i));
+    }
+
+    // Samples past this level's last full entry are only in the levels below, or still pending
+    if (end > covered)
+    {
+        if (level > 0)
+            addRange(level - 1, juce::jmax(start, covered), end, result, found);
+        else if (numPending > 0)
+            include(pending);
+    }
+}
+
+void FancyIconPack::WaveformPyramid::getColumns(juce::Range<juce::int64> sampleRange, int numColumns,
+                                                juce::Range<float>* columns) const
+{
+    const juce::ScopedLock sl(lock);
+
+    auto start = juce::jmax((juce::int64) 0, sampleRange.getStart());
+    auto end = juce::jmin(numSamples, sampleRange.getEnd());
+    auto samplesPerColumn = (double) (sampleRange.getEnd() - sampleRange.getStart()) / juce::jmax(1, numColumns);
+
+    // The coarsest level whose blocks fit in a column, so each column reads at most three entries
+    auto level = -1;
+
+    while (level + 1 < levels.size() && (double) ((juce::int64) baseBlockSize << (level + 1)) <= samplesPerColumn)
+        ++level;
+
+    if (level < 0 && ! levels.isEmpty())
+        level = 0;
+
+    for (int i = 0; i < numColumns; ++i)
+    {
+        auto columnStart = juce::jmax(start, sampleRange.getStart() + (juce::int64) (i * samplesPerColumn));
+        auto columnEnd = juce::jmin(end, sampleRange.getStart() + (juce::int64) ((i + 1) * samplesPerColumn));
+
+        juce::Range<float> column;
+        auto found = false;
+
+        if (columnStart < columnEnd)
+            addRange(level, columnStart, columnEnd, column, found);
+
+        columns[i] = column;
+    }
+}
+
+void FancyIconPack::WaveformPyramid::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                          juce::Range<juce::int64> sampleRange) const
+{
+    auto stroke = getOptimalStrokeWidth(bounds);
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto numColumns = juce::jmax(1, juce::roundToInt(bounds.getWidth() * scale));
+    auto columnWidth = bounds.getWidth() / (float) numColumns;
+    auto centreY = bounds.getCentreY();
+    auto halfHeight = bounds.getHeight() * 0.5f;
+
+    // Center line, as in drawWaveformDisplay
+    g.setColour(color.withAlpha(0.3f));
+    g.fillRect(bounds.getX(), centreY - stroke * 0.25f, bounds.getWidth(), stroke * 0.5f);
+
+    g.setColour(color);
+
+    juce::Range<float> columns[drawChunkSize];
+    auto length = sampleRange.getLength();
+    auto available = juce::Range<juce::int64>(0, getNumSamples());
+
+    for (int first = 0; first < numColumns; first += drawChunkSize)
+    {
+        auto num = juce::jmin(drawChunkSize, numColumns - first);
+        juce::Range<juce::int64> chunkRange(sampleRange.getStart() + length * first / numColumns,
+                                            sampleRange.getStart() + length * (first + num) / numColumns);
+        getColumns(chunkRange, num, columns);
+
+        for (int i = 0; i < num; ++i)
+        {
+            auto columnStart = sampleRange.getStart() + length * (first + i) / numColumns;
+
+            if (! available.contains(columnStart))
+                continue;
+
+            auto top = centreY - juce::jlimit(-1.0f, 1.0f, columns[i].getEnd()) * halfHeight;
+            auto bottom = centreY - juce::jlimit(-1.0f, 1.0f, columns[i].getStart()) * halfHeight;
+
+            // At least one physical pixel tall, so silence still shows
+            g.fillRect(bounds.getX() + (first + i) * columnWidth, top, columnWidth,
+                       juce::jmax(bottom - top, 1.0f / scale));
+        }
+    }
+}
+
+void FancyIconPack::WaveformPyramid::draw(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color) const
+{
+    draw(g, bounds, color, { 0, getNumSamples() });
+}
+
+size_t FancyIconPack::WaveformPyramid::getMemoryUsage() const
+{
+    const juce::ScopedLock sl(lock);
+    size_t total = 0;
+
+    for (auto& entries : levels)
+        total += (size_t) entries.size() * sizeof(juce::Range<float>);
+
+    return total;
+}
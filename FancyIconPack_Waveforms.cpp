@@ -0,0 +1,265 @@
+#include "FancyIconPack.h"
+
+// ============================================================================
+// PARAMETRIC WAVEFORMS IMPLEMENTATION
+// ============================================================================
+
+namespace
+{
+    using WaveShape = FancyIconPack::WaveShape;
+
+    // Enough for smooth sines at badge sizes; edges are added separately
+    constexpr int samplesPerCycle = 32;
+
+    // Offset used to read the value just before an edge
+    constexpr float edgeEpsilon = 1.0e-4f;
+
+    // More cycles than this can't be told apart at icon sizes, and would only grow the sample list
+    constexpr float maxCycles = 64.0f;
+
+    WaveShape getMorphTarget(WaveShape shape) noexcept
+    {
+        return static_cast<WaveShape>(((int) shape + 1) % FancyIconPack::numWaveShapes);
+    }
+
+    bool hasEdges(WaveShape shape) noexcept
+    {
+        return shape == WaveShape::saw || shape == WaveShape::square;
+    }
+
+    /** Phases within one cycle where a shape jumps */
+    void addEdges(juce::Array<float>& edges, WaveShape shape, float pulseWidth)
+    {
+        if (hasEdges(shape))
+            edges.addIfNotAlreadyThere(0.0f);
+
+        if (shape == WaveShape::square)
+            edges.addIfNotAlreadyThere(pulseWidth);
+    }
+
+    float evaluate(const FancyIconPack::WaveParameters& wave, float phase) noexcept
+    {
+        auto& tables = FancyIconPack::WaveTables::getInstance();
+        auto value = tables.getValue(wave.shape, phase, wave.pulseWidth);
+
+        if (wave.morph > 0.0f)
+            value += (tables.getValue(getMorphTarget(wave.shape), phase, wave.pulseWidth) - value) * wave.morph;
+
+        return value;
+    }
+
+    void drawWaveBadge(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                       const FancyIconPack::WaveParameters& wave, const juce::String& label, float fontScale)
+    {
+        auto iconBounds = bounds;
+        auto stroke = FancyIconPack::getOptimalStrokeWidth(iconBounds);
+
+        auto waveArea = iconBounds.removeFromTop(iconBounds.getHeight() * 0.6f);
+        auto amplitude = waveArea.getHeight() * 0.35f;
+
+        g.setColour(color);
+        g.strokePath(FancyIconPack::createWavePath(waveArea.withSizeKeepingCentre(waveArea.getWidth(), amplitude * 2.0f),
+                                                   wave),
+                     FancyIconPack::createWaveStroke(wave, stroke));
+
+        g.setFont(juce::Font(iconBounds.getHeight() * fontScale, juce::Font::bold));
+        g.drawText(label, iconBounds, juce::Justification::centred);
+    }
+}
+
+// ============================================================================
+// WaveTables
+// ============================================================================
+
+FancyIconPack::WaveTables::WaveTables()
+{
+    for (int i = 0; i <= tableSize; ++i)
+    {
+        auto phase = i / static_cast<float>(tableSize);
+
+        tables[(int) WaveShape::sine][i] = std::sin(phase * juce::MathConstants<float>::twoPi);
+        tables[(int) WaveShape::triangle][i] = phase < 0.25f ? phase * 4.0f
+                                             : phase < 0.75f ? 2.0f - phase * 4.0f
+                                                             : phase * 4.0f - 4.0f;
+        tables[(int) WaveShape::saw][i] = phase * 2.0f - 1.0f;
+    }
+}
+
+const FancyIconPack::WaveTables& FancyIconPack::WaveTables::getInstance()
+{
+    static const WaveTables instance;
+    return instance;
+}
+
+float FancyIconPack::WaveTables::getValue(WaveShape shape, float phase, float pulseWidth) const noexcept
+{
+    phase -= std::floor(phase);
+
+    if (shape == WaveShape::square)
+        return phase < pulseWidth ? 1.0f : -1.0f;
+
+    auto position = phase * tableSize;
+    auto index = juce::jmin((int) position, tableSize - 1);
+    auto* table = tables[(int) shape];
+
+    return table[index] + (table[index + 1] - table[index]) * (position - (float) index);
+}
+
+// ============================================================================
+// Wave paths
+// ============================================================================
+
+juce::Path FancyIconPack::createWavePath(juce::Rectangle<float> area, const WaveParameters& wave)
+{
+    auto cycles = juce::jlimit(0.01f, maxCycles, wave.cycles);
+
+    // Callers keep advancing the phase, so wrap it before float resolution runs out
+    auto startPhase = wave.phase - std::floor(wave.phase);
+    auto endPhase = startPhase + cycles;
+
+    auto toX = [&](float phase) { return area.getX() + (phase - startPhase) / cycles * area.getWidth(); };
+    auto toY = [&](float value) { return area.getCentreY() - value * area.getHeight() * 0.5f; };
+
+    juce::Array<float> edges;
+    addEdges(edges, wave.shape, wave.pulseWidth);
+
+    if (wave.morph > 0.0f)
+        addEdges(edges, getMorphTarget(wave.shape), wave.pulseWidth);
+
+    // Uniform samples, plus the phase of every edge inside the visible range
+    struct Sample
+    {
+        float phase;
+        bool isEdge;
+    };
+
+    juce::Array<Sample> samples;
+    auto numSamples = juce::jmax(16, (int) std::ceil(samplesPerCycle * cycles));
+
+    for (int i = 0; i <= numSamples; ++i)
+        samples.add({ startPhase + cycles * i / (float) numSamples, false });
+
+    for (auto cycle = std::floor(startPhase); cycle < endPhase; cycle += 1.0f)
+    {
+        for (auto edge : edges)
+        {
+            auto phase = cycle + edge;
+
+            if (phase > startPhase && phase < endPhase)
+                samples.add({ phase, true });
+        }
+    }
+
+    // On a tie the edge goes first, so its vertical drop isn't preceded by the post-edge value
+    std::stable_sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b)
+    {
+        return a.phase < b.phase || (a.phase == b.phase && a.isEdge && ! b.isEdge);
+    });
+
+    juce::Path path;
+    auto lastX = toX(startPhase);
+    path.startNewSubPath(lastX, toY(evaluate(wave, startPhase)));
+
+    for (int i = 1; i < samples.size(); ++i)
+    {
+        auto& sample = samples.getReference(i);
+        auto& previous = samples.getReference(i - 1);
+
+        // A uniform sample on top of an edge would only add a zero-length segment to miter
+        if (! sample.isEdge && previous.isEdge && sample.phase - previous.phase < edgeEpsilon)
+            continue;
+
+        auto x = toX(sample.phase);
+        jassert(x >= lastX);
+        lastX = x;
+
+        if (sample.isEdge)
+            path.lineTo(x, toY(evaluate(wave, sample.phase - edgeEpsilon)));
+
+        path.lineTo(x, toY(evaluate(wave, sample.phase)));
+    }
+
+    return path;
+}
+
+juce::PathStrokeType FancyIconPack::createWaveStroke(const WaveParameters& wave, float strokeWidth)
+{
+    auto edges = hasEdges(wave.shape) || (wave.morph > 0.0f && hasEdges(getMorphTarget(wave.shape)));
+
+    return edges ? createStroke(strokeWidth, juce::PathStrokeType::mitered, juce::PathStrokeType::butt)
+                 : createStroke(strokeWidth);
+}
+
+// ============================================================================
+// Waveform icons
+// ============================================================================
+
+void FancyIconPack::drawWaveShape(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                                  const WaveParameters& wave)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+    auto waveY = iconBounds.getCentreY();
+    auto amplitude = iconBounds.getHeight() * 0.35f;
+
+    g.setColour(color);
+    g.strokePath(createWavePath(iconBounds.withSizeKeepingCentre(iconBounds.getWidth(), amplitude * 2.0f), wave),
+                 createWaveStroke(wave, stroke));
+
+    // Center line reference
+    g.setColour(color.withAlpha(0.3f));
+    g.drawLine(iconBounds.getX(), waveY, iconBounds.getRight(), waveY, stroke * 0.5f);
+}
+
+void FancyIconPack::drawLFO(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                            const WaveParameters& wave)
+{
+    auto iconBounds = bounds;
+    auto stroke = getOptimalStrokeWidth(iconBounds);
+    auto waveY = iconBounds.getCentreY();
+    auto amplitude = iconBounds.getHeight() * 0.3f;
+
+    g.setColour(color);
+    g.strokePath(createWavePath(iconBounds.withSizeKeepingCentre(iconBounds.getWidth(), amplitude * 2.0f), wave),
+                 createWaveStroke(wave, stroke));
+
+    // Center line
+    g.setColour(color.withAlpha(0.3f));
+    g.drawLine(iconBounds.getX(), waveY, iconBounds.getRight(), waveY, stroke * 0.5f);
+}
+
+void FancyIconPack::drawLFO1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "LFO1", 0.6f);
+}
+
+void FancyIconPack::drawLFO2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "LFO2", 0.6f);
+}
+
+void FancyIconPack::drawLFO3(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "LFO3", 0.6f);
+}
+
+void FancyIconPack::drawOsc1(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "1", 0.8f);
+}
+
+void FancyIconPack::drawOsc2(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "2", 0.8f);
+}
+
+void FancyIconPack::drawOsc3(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour color,
+                             const WaveParameters& wave)
+{
+    drawWaveBadge(g, bounds, color, wave, "3", 0.8f);
+}